@@ -0,0 +1,91 @@
+/* Copyright (c) 2019 The Khronos Group Inc.
+ * Copyright (c) 2019 Valve Corporation
+ * Copyright (c) 2019 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef BIND_POINT_STATE_H_
+#define BIND_POINT_STATE_H_
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "vulkan/vulkan_core.h"
+
+// Keeps one State for each pipeline bind point inline, indexed by VkPipelineBindPoint. The bind point enum is sparse, so the
+// known bind points are mapped to consecutive slots. Values the layer does not know, which parameter validation reports, all
+// share one extra slot so they cannot disturb the state of the real bind points.
+template <typename State>
+class BindPointArray {
+   public:
+    static const uint32_t kCount = 4;
+
+    static uint32_t Index(VkPipelineBindPoint bind_point) {
+        switch (bind_point) {
+            case VK_PIPELINE_BIND_POINT_GRAPHICS:
+                return 0;
+            case VK_PIPELINE_BIND_POINT_COMPUTE:
+                return 1;
+            case VK_PIPELINE_BIND_POINT_RAY_TRACING_NV:
+                return 2;
+            default:
+                return kCount - 1;
+        }
+    }
+
+    State &operator[](VkPipelineBindPoint bind_point) { return states_[Index(bind_point)]; }
+    const State &operator[](VkPipelineBindPoint bind_point) const { return states_[Index(bind_point)]; }
+
+    State *begin() { return states_; }
+    State *end() { return states_ + kCount; }
+    const State *begin() const { return states_; }
+    const State *end() const { return states_ + kCount; }
+
+   private:
+    State states_[kCount];
+};
+
+// Where the dynamic offsets of one bound descriptor set are kept in a DynamicOffsetArena. capacity is the room reserved for the
+// set index, which stays with it when a set with fewer offsets is bound.
+struct DynamicOffsetRange {
+    uint32_t begin = 0;
+    uint32_t count = 0;
+    uint32_t capacity = 0;
+};
+
+// Stores the dynamic offsets of all the descriptor sets bound to a command buffer in one buffer. Binding a set reuses the room
+// of the range it replaces whenever the new offsets fit, so the arena only grows while a recording binds more offsets to a set
+// index than it has before. Clearing it for the next recording keeps the buffer, so once a command buffer has been recorded the
+// bind path no longer allocates. Ranges must be reset whenever the arena is cleared.
+class DynamicOffsetArena {
+   public:
+    void Assign(DynamicOffsetRange *range, const uint32_t *offsets, uint32_t count) {
+        if (count > range->capacity) {
+            range->begin = static_cast<uint32_t>(offsets_.size());
+            range->capacity = count;
+            offsets_.resize(offsets_.size() + count);
+        }
+        std::copy(offsets, offsets + count, offsets_.begin() + range->begin);
+        range->count = count;
+    }
+
+    const uint32_t *Get(const DynamicOffsetRange &range) const { return offsets_.data() + range.begin; }
+
+    void clear() { offsets_.clear(); }
+
+   private:
+    std::vector<uint32_t> offsets_;
+};
+
+#endif  // BIND_POINT_STATE_H_
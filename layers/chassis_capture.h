@@ -0,0 +1,415 @@
+/* Copyright (c) 2019 The Khronos Group Inc.
+ * Copyright (c) 2019 Valve Corporation
+ * Copyright (c) 2019 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CHASSIS_CAPTURE_H
+#define CHASSIS_CAPTURE_H
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "vulkan/vulkan.h"
+
+// Builds the payload of one captured call. Values are written in the host's byte order and layout: the capture is replayed on
+// a machine of the same architecture, which the file header records.
+class ApiCaptureEncoder {
+   public:
+    void Clear() { data_.clear(); }
+    const uint8_t *data() const { return data_.data(); }
+    size_t size() const { return data_.size(); }
+
+    void Bytes(const void *bytes, size_t size) {
+        const size_t offset = data_.size();
+        data_.resize(offset + size);
+        if (size) memcpy(&data_[offset], bytes, size);
+    }
+
+    // Scalars, enums, and structs or unions that hold no pointers
+    template <typename T>
+    void Value(const T &value) {
+        Bytes(&value, sizeof(T));
+    }
+
+    // Pointers that are recorded but not followed, such as pUserData or the address returned by vkMapMemory
+    template <typename T>
+    void Address(T *pointer) {
+        Value(static_cast<uint64_t>(reinterpret_cast<uintptr_t>(pointer)));
+    }
+
+    // Writes whether a pointer is set, and returns true if its contents should follow
+    bool Pointer(const void *pointer) {
+        Value<uint8_t>(pointer != nullptr);
+        return pointer != nullptr;
+    }
+
+    void Count(uint64_t count) { Value(count); }
+
+    // A null-terminated string, written as its length plus one, or zero for a null pointer, followed by its characters
+    void String(const char *string) {
+        const uint32_t length = string ? static_cast<uint32_t>(strlen(string)) + 1 : 0;
+        Value(length);
+        if (length > 1) Bytes(string, length - 1);
+    }
+
+    // An array of values that hold no pointers
+    template <typename T>
+    void Array(const T *values, uint64_t count) {
+        if (Pointer(values)) {
+            Count(count);
+            Bytes(values, static_cast<size_t>(sizeof(T) * count));
+        }
+    }
+
+    // Untyped data with its size in bytes, such as pInitialData or the pValues of vkCmdPushConstants
+    void Blob(const void *data, uint64_t size) { Array(static_cast<const uint8_t *>(data), size); }
+
+   private:
+    std::vector<uint8_t> data_;
+};
+
+// Conditions under which the implementation reads struct members that it otherwise ignores, and that applications may then
+// leave dangling. The generated encoders record these members as null when the condition does not hold.
+static inline bool CaptureUsesImageInfo(VkDescriptorType type) {
+    return type == VK_DESCRIPTOR_TYPE_SAMPLER || type == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER ||
+           type == VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE || type == VK_DESCRIPTOR_TYPE_STORAGE_IMAGE ||
+           type == VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT;
+}
+
+static inline bool CaptureUsesBufferInfo(VkDescriptorType type) {
+    return type == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER || type == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER ||
+           type == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC || type == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC;
+}
+
+static inline bool CaptureUsesTexelBufferView(VkDescriptorType type) {
+    return type == VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER || type == VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER;
+}
+
+static inline bool CaptureUsesImmutableSamplers(VkDescriptorType type) {
+    return type == VK_DESCRIPTOR_TYPE_SAMPLER || type == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+}
+
+static inline bool CaptureUsesTessellationState(const VkGraphicsPipelineCreateInfo &create_info) {
+    if (!create_info.pStages) return false;
+    for (uint32_t i = 0; i < create_info.stageCount; ++i) {
+        if (create_info.pStages[i].stage &
+            (VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT | VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static inline bool CaptureUsesRasterizationState(const VkGraphicsPipelineCreateInfo &create_info) {
+    return create_info.pRasterizationState && !create_info.pRasterizationState->rasterizerDiscardEnable;
+}
+
+// Writes the stream of intercepted calls to a binary capture file that the offline replayer feeds back through the validation
+// objects. Each thread appends its records to its own byte ring without locking, and a background thread drains the rings to
+// the file every 100ms. Records are never dropped: a thread that finds its ring full writes out the rings itself, and a
+// record larger than a ring is written straight to the file.
+//
+// The file starts with the header
+//     u32 magic, u32 version, u32 pointer size, u32 command count, command count * (u32 length, name characters)
+// which names the commands in CaptureId order, so that a replayer built with other platform extensions can map them to its
+// own IDs. Records follow, each
+//     u32 size of the rest of the record, u64 sequence number, u32 thread index, u32 command index, payload
+// Records of different threads are interleaved in the order their rings were drained; sorting by sequence number recovers the
+// order in which the calls returned. Destroy and free calls are the exception: they are numbered before they are dispatched,
+// since the driver may hand their handles to a create on another thread as soon as they return. A record cut short at the end
+// of the file was still being written when the application exited.
+class ApiCapture {
+   public:
+    static const uint32_t kMagic = 0x50435656;  // "VVCP"
+    static const uint32_t kVersion = 1;
+    static const size_t kRingCapacity = 1 << 20;
+    static const size_t kRecordHeaderSize = sizeof(uint32_t) + sizeof(uint64_t) + 2 * sizeof(uint32_t);
+
+    ApiCapture(const std::string &output_path, uint32_t command_count, const char *const *command_names)
+        : output_(output_path, std::ios::out | std::ios::trunc | std::ios::binary) {
+        const uint32_t header[] = {kMagic, kVersion, static_cast<uint32_t>(sizeof(void *)), command_count};
+        output_.write(reinterpret_cast<const char *>(header), sizeof(header));
+        for (uint32_t command = 0; command < command_count; ++command) {
+            const uint32_t length = static_cast<uint32_t>(strlen(command_names[command]));
+            output_.write(reinterpret_cast<const char *>(&length), sizeof(length));
+            output_.write(command_names[command], length);
+        }
+        output_.flush();
+    }
+
+    ~ApiCapture() {
+        Stop();
+        Flush();
+    }
+
+    // The capture that intercepts record calls to, or null when capture is disabled
+    static ApiCapture *Active() { return ActiveCapture().load(std::memory_order_acquire); }
+    static void SetActive(ApiCapture *capture) { ActiveCapture().store(capture, std::memory_order_release); }
+
+    // The calling thread's encoder, emptied for a new record
+    ApiCaptureEncoder &BeginRecord() {
+        static thread_local ApiCaptureEncoder encoder;
+        encoder.Clear();
+        return encoder;
+    }
+
+    // Number the calling thread's next record now, before its call is dispatched
+    void ReserveSequence() { ReservedSequence() = sequence_.fetch_add(1, std::memory_order_relaxed) + 1; }
+
+    // Append the record of a call that has returned
+    void Record(uint32_t command, const ApiCaptureEncoder &encoder) {
+        ThreadRing &ring = GetThreadRing();
+        const uint32_t header_size[] = {static_cast<uint32_t>(kRecordHeaderSize - sizeof(uint32_t) + encoder.size())};
+        const size_t record_size = kRecordHeaderSize + encoder.size();
+        if (record_size > kRingCapacity) {
+            const uint64_t sequence = NextSequence();
+            const uint32_t ids[] = {ring.thread_index, command};
+            std::lock_guard<std::mutex> lock(flush_lock_);
+            output_.write(reinterpret_cast<const char *>(header_size), sizeof(header_size));
+            output_.write(reinterpret_cast<const char *>(&sequence), sizeof(sequence));
+            output_.write(reinterpret_cast<const char *>(ids), sizeof(ids));
+            output_.write(reinterpret_cast<const char *>(encoder.data()), encoder.size());
+            return;
+        }
+        uint64_t head = ring.head.load(std::memory_order_relaxed);
+        if (kRingCapacity - (head - ring.tail.load(std::memory_order_acquire)) < record_size) Flush();
+        // The sequence number is taken once the record is sure to fit, so that a thread writing out the rings does not hold
+        // back records numbered after its own
+        const uint64_t sequence = NextSequence();
+        const uint32_t ids[] = {ring.thread_index, command};
+        head = RingWrite(ring, head, header_size, sizeof(header_size));
+        head = RingWrite(ring, head, &sequence, sizeof(sequence));
+        head = RingWrite(ring, head, ids, sizeof(ids));
+        head = RingWrite(ring, head, encoder.data(), encoder.size());
+        ring.head.store(head, std::memory_order_release);
+    }
+
+    // Each instance created with capture enabled keeps the capture active and its writer running until the last one is destroyed
+    void AddInstance() {
+        std::lock_guard<std::mutex> lock(instances_lock_);
+        if (instance_count_++ > 0) return;
+        SetActive(this);
+        Start();
+    }
+    void RemoveInstance() {
+        std::lock_guard<std::mutex> lock(instances_lock_);
+        if (instance_count_ == 0 || --instance_count_ > 0) return;
+        SetActive(nullptr);
+        Stop();
+    }
+
+    // Start the background writer, if it is not already running
+    void Start() {
+        std::lock_guard<std::mutex> lock(writer_lock_);
+        if (writer_.joinable()) return;
+        stop_writer_ = false;
+        writer_ = std::thread(&ApiCapture::WriterLoop, this);
+    }
+
+    // Stop the background writer and write out everything recorded so far
+    void Stop() {
+        {
+            std::lock_guard<std::mutex> lock(writer_lock_);
+            if (!writer_.joinable()) return;
+            stop_writer_ = true;
+        }
+        writer_wake_.notify_one();
+        writer_.join();
+        Flush();
+    }
+
+    // Write out the records appended so far
+    void Flush() {
+        std::lock_guard<std::mutex> flush_lock(flush_lock_);
+        std::vector<ThreadRing *> rings;
+        {
+            std::lock_guard<std::mutex> lock(rings_lock_);
+            for (const auto &ring : rings_) rings.push_back(ring.get());
+        }
+        for (auto ring : rings) {
+            const uint64_t head = ring->head.load(std::memory_order_acquire);
+            const uint64_t tail = ring->tail.load(std::memory_order_relaxed);
+            if (head == tail) continue;
+            const size_t start = static_cast<size_t>(tail % kRingCapacity);
+            const size_t size = static_cast<size_t>(head - tail);
+            const size_t first = std::min(size, kRingCapacity - start);
+            output_.write(reinterpret_cast<const char *>(&ring->bytes[start]), first);
+            output_.write(reinterpret_cast<const char *>(&ring->bytes[0]), size - first);
+            ring->tail.store(head, std::memory_order_release);
+        }
+        output_.flush();
+    }
+
+    // Descriptor update templates give the size of the pData of vkUpdateDescriptorSetWithTemplate, which the call itself does
+    // not. Handles are the ones the application sees.
+    void AddUpdateTemplate(uint64_t update_template, const VkDescriptorUpdateTemplateCreateInfo *create_info) {
+        size_t data_size = 0;
+        for (uint32_t i = 0; i < create_info->descriptorUpdateEntryCount; ++i) {
+            const VkDescriptorUpdateTemplateEntry &entry = create_info->pDescriptorUpdateEntries[i];
+            if (entry.descriptorCount == 0) continue;
+            size_t element_size = 0;
+            switch (entry.descriptorType) {
+                case VK_DESCRIPTOR_TYPE_SAMPLER:
+                case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+                case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+                case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+                case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+                    element_size = sizeof(VkDescriptorImageInfo);
+                    break;
+                case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+                case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+                case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+                case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
+                    element_size = sizeof(VkDescriptorBufferInfo);
+                    break;
+                case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+                case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+                    element_size = sizeof(VkBufferView);
+                    break;
+                case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_NV:
+                    element_size = sizeof(VkAccelerationStructureNV);
+                    break;
+                case VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT:
+                    // The descriptor count of an inline uniform block is its size in bytes
+                    data_size = std::max(data_size, entry.offset + entry.descriptorCount);
+                    continue;
+                default:
+                    continue;
+            }
+            data_size = std::max(data_size, entry.offset + (entry.descriptorCount - 1) * entry.stride + element_size);
+        }
+        std::lock_guard<std::mutex> lock(update_templates_lock_);
+        update_template_data_sizes_[update_template] = data_size;
+    }
+
+    void RemoveUpdateTemplate(uint64_t update_template) {
+        std::lock_guard<std::mutex> lock(update_templates_lock_);
+        update_template_data_sizes_.erase(update_template);
+    }
+
+    size_t UpdateTemplateDataSize(uint64_t update_template) {
+        std::lock_guard<std::mutex> lock(update_templates_lock_);
+        auto it = update_template_data_sizes_.find(update_template);
+        return it == update_template_data_sizes_.end() ? 0 : it->second;
+    }
+
+   private:
+    struct ThreadRing {
+        std::unique_ptr<uint8_t[]> bytes{new uint8_t[kRingCapacity]};
+        std::atomic<uint64_t> head{0};
+        std::atomic<uint64_t> tail{0};
+        uint32_t thread_index = 0;
+        std::thread::id thread_id;
+    };
+
+    // The calling thread's ring in the capture it last recorded into
+    struct ThreadRingCache {
+        uint64_t capture_id = 0;
+        ThreadRing *ring = nullptr;
+    };
+
+    static std::atomic<ApiCapture *> &ActiveCapture() {
+        static std::atomic<ApiCapture *> active_capture{nullptr};
+        return active_capture;
+    }
+
+    // The sequence number plus one that ReserveSequence took for the calling thread's next record, or zero
+    static uint64_t &ReservedSequence() {
+        static thread_local uint64_t reserved_sequence = 0;
+        return reserved_sequence;
+    }
+
+    uint64_t NextSequence() {
+        uint64_t &reserved = ReservedSequence();
+        if (!reserved) return sequence_.fetch_add(1, std::memory_order_relaxed);
+        const uint64_t sequence = reserved - 1;
+        reserved = 0;
+        return sequence;
+    }
+
+    // Copy bytes in at the given head position, wrapping around the end of the ring, and return the new head
+    static uint64_t RingWrite(ThreadRing &ring, uint64_t head, const void *bytes, size_t size) {
+        const size_t start = static_cast<size_t>(head % kRingCapacity);
+        const size_t first = std::min(size, kRingCapacity - start);
+        memcpy(&ring.bytes[start], bytes, first);
+        memcpy(&ring.bytes[0], static_cast<const uint8_t *>(bytes) + first, size - first);
+        return head + size;
+    }
+
+    // The calling thread's ring, allocated and registered on its first use. The layer records into one capture for the life of
+    // the process, which the per-thread cache always hits. Captures are told apart by ID rather than address, so that a
+    // capture allocated where a destroyed one was does not pick up its rings.
+    ThreadRing &GetThreadRing() {
+        static thread_local ThreadRingCache cache;
+        if (cache.capture_id == capture_id_) return *cache.ring;
+        const auto thread_id = std::this_thread::get_id();
+        std::lock_guard<std::mutex> lock(rings_lock_);
+        auto found = std::find_if(rings_.begin(), rings_.end(),
+                                  [thread_id](const std::unique_ptr<ThreadRing> &ring) { return ring->thread_id == thread_id; });
+        if (found == rings_.end()) {
+            std::unique_ptr<ThreadRing> ring(new ThreadRing);
+            ring->thread_index = static_cast<uint32_t>(rings_.size()) + 1;
+            ring->thread_id = thread_id;
+            rings_.emplace_back(std::move(ring));
+            found = rings_.end() - 1;
+        }
+        cache.capture_id = capture_id_;
+        cache.ring = found->get();
+        return *cache.ring;
+    }
+
+    static uint64_t NextCaptureId() {
+        static std::atomic<uint64_t> capture_count{0};
+        return capture_count.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+
+    void WriterLoop() {
+        std::unique_lock<std::mutex> lock(writer_lock_);
+        while (!stop_writer_) {
+            writer_wake_.wait_for(lock, std::chrono::milliseconds(100));
+            lock.unlock();
+            Flush();
+            lock.lock();
+        }
+    }
+
+    const uint64_t capture_id_ = NextCaptureId();
+    std::ofstream output_;
+    std::atomic<uint64_t> sequence_{0};
+    std::vector<std::unique_ptr<ThreadRing>> rings_;
+    std::mutex rings_lock_;
+    std::mutex flush_lock_;
+    std::thread writer_;
+    std::mutex writer_lock_;
+    std::condition_variable writer_wake_;
+    bool stop_writer_ = false;
+    std::unordered_map<uint64_t, size_t> update_template_data_sizes_;
+    std::mutex update_templates_lock_;
+    std::mutex instances_lock_;
+    uint32_t instance_count_ = 0;
+};
+
+#endif  // CHASSIS_CAPTURE_H
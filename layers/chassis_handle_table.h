@@ -0,0 +1,172 @@
+/* Copyright (c) 2019 The Khronos Group Inc.
+ * Copyright (c) 2019 Valve Corporation
+ * Copyright (c) 2019 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CHASSIS_HANDLE_TABLE_H
+#define CHASSIS_HANDLE_TABLE_H
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+
+// Maps the unique IDs handed out for wrapped non-dispatchable handles back to the driver's handles. An ID encodes the index of
+// its slot in the table and the generation of that slot, so unwrapping is an array load plus a generation check, and an ID
+// that has been removed, or was never handed out, unwraps to VK_NULL_HANDLE. Slots live in fixed-size slabs that are allocated
+// as the table grows and never move. Wrap, Unwrap and Remove take no locks; removed slots are reused through a lock-free free
+// list, with a new generation so that stale IDs do not match them. Once every index is in use, further IDs are handed out
+// from a locked map, as all IDs were before the table; they have the top bit set, which no table ID can have.
+class WrappedHandleTable {
+   public:
+    static const uint32_t kSlabBits = 13;
+    static const uint32_t kSlabSize = 1 << kSlabBits;
+    static const uint32_t kSlabCount = 1 << 13;
+    static const uint32_t kIndexBits = kSlabBits + 13;
+
+    WrappedHandleTable() {
+        for (auto &slab : slabs_) slab.store(nullptr, std::memory_order_relaxed);
+    }
+    ~WrappedHandleTable() {
+        for (auto &slab : slabs_) delete[] slab.load(std::memory_order_relaxed);
+    }
+
+    // Allocate an ID for a driver handle. Never returns zero.
+    uint64_t Wrap(uint64_t handle) {
+        const uint32_t index = AllocateIndex();
+        if (index == kNoIndex) return WrapOverflow(handle);
+        Slot &slot = GetSlot(index);
+        slot.handle.store(handle, std::memory_order_relaxed);
+        const uint64_t generation = slot.generation.load(std::memory_order_relaxed);
+        slot.live.store(generation + 1, std::memory_order_release);
+        return ((generation + 1) << kIndexBits) | index;
+    }
+
+    // The driver handle of an ID, or VK_NULL_HANDLE if the ID is not live
+    uint64_t Unwrap(uint64_t id) const {
+        if (id & kOverflowBit) return UnwrapOverflow(id);
+        const Slot *slot = FindSlot(id);
+        return slot ? slot->handle.load(std::memory_order_relaxed) : 0;
+    }
+
+    // Release an ID, returning its driver handle, or VK_NULL_HANDLE if the ID is not live
+    uint64_t Remove(uint64_t id) {
+        if (id & kOverflowBit) return RemoveOverflow(id);
+        Slot *slot = const_cast<Slot *>(FindSlot(id));
+        if (!slot) return 0;
+        uint64_t live = id >> kIndexBits;
+        if (!slot->live.compare_exchange_strong(live, 0, std::memory_order_acq_rel)) return 0;
+        const uint64_t handle = slot->handle.load(std::memory_order_relaxed);
+        slot->generation.store(live, std::memory_order_relaxed);
+        // A slot whose next generation would reach the overflow bit is retired rather than reused
+        if (live < kMaxGeneration) FreeIndex(static_cast<uint32_t>(id & kIndexMask));
+        return handle;
+    }
+
+   private:
+    static const uint64_t kIndexMask = (uint64_t(1) << kIndexBits) - 1;
+    static const uint32_t kNoIndex = 0xffffffff;
+    static const uint64_t kOverflowBit = uint64_t(1) << 63;
+    static const uint64_t kMaxGeneration = (kOverflowBit >> kIndexBits) - 1;
+
+    struct Slot {
+        std::atomic<uint64_t> handle{0};
+        // Generation of the ID that currently owns the slot, or zero while the slot is free
+        std::atomic<uint64_t> live{0};
+        // Generation of the last ID that owned the slot
+        std::atomic<uint64_t> generation{0};
+        std::atomic<uint32_t> next_free{0};
+    };
+
+    const Slot *FindSlot(uint64_t id) const {
+        const uint64_t live = id >> kIndexBits;
+        if (live == 0) return nullptr;
+        const uint32_t index = static_cast<uint32_t>(id & kIndexMask);
+        const Slot *slab = slabs_[index >> kSlabBits].load(std::memory_order_acquire);
+        if (!slab) return nullptr;
+        const Slot &slot = slab[index & (kSlabSize - 1)];
+        if (slot.live.load(std::memory_order_acquire) != live) return nullptr;
+        return &slot;
+    }
+
+    Slot &GetSlot(uint32_t index) { return slabs_[index >> kSlabBits].load(std::memory_order_acquire)[index & (kSlabSize - 1)]; }
+
+    // The free list head packs a counter, bumped on every pop, above the index plus one of the first free slot, so that a
+    // pop racing with a pop and push of the same slot fails its compare-exchange. Returns kNoIndex when every index is in use.
+    uint32_t AllocateIndex() {
+        uint64_t head = free_head_.load(std::memory_order_acquire);
+        while (static_cast<uint32_t>(head) != 0) {
+            const uint32_t index = static_cast<uint32_t>(head) - 1;
+            const uint32_t next = GetSlot(index).next_free.load(std::memory_order_relaxed);
+            const uint64_t new_head = (((head >> 32) + 1) << 32) | next;
+            if (free_head_.compare_exchange_weak(head, new_head, std::memory_order_acq_rel, std::memory_order_acquire)) {
+                return index;
+            }
+        }
+        // next_index_ stops at the end of the table rather than wrapping around onto indices that are in use
+        uint32_t index = next_index_.load(std::memory_order_relaxed);
+        do {
+            if (index > kIndexMask) return kNoIndex;
+        } while (!next_index_.compare_exchange_weak(index, index + 1, std::memory_order_relaxed));
+        std::atomic<Slot *> &slab = slabs_[index >> kSlabBits];
+        if (!slab.load(std::memory_order_acquire)) {
+            Slot *new_slab = new Slot[kSlabSize];
+            Slot *expected = nullptr;
+            if (!slab.compare_exchange_strong(expected, new_slab, std::memory_order_acq_rel)) delete[] new_slab;
+        }
+        return index;
+    }
+
+    void FreeIndex(uint32_t index) {
+        Slot &slot = GetSlot(index);
+        uint64_t head = free_head_.load(std::memory_order_relaxed);
+        do {
+            slot.next_free.store(static_cast<uint32_t>(head), std::memory_order_relaxed);
+        } while (!free_head_.compare_exchange_weak(head, (head & ~uint64_t(0xffffffff)) | (index + 1), std::memory_order_release,
+                                                   std::memory_order_relaxed));
+    }
+
+    uint64_t WrapOverflow(uint64_t handle) {
+        std::lock_guard<std::mutex> lock(overflow_lock_);
+        const uint64_t id = kOverflowBit | ++overflow_count_;
+        overflow_[id] = handle;
+        return id;
+    }
+
+    uint64_t UnwrapOverflow(uint64_t id) const {
+        std::lock_guard<std::mutex> lock(overflow_lock_);
+        auto it = overflow_.find(id);
+        return it != overflow_.end() ? it->second : 0;
+    }
+
+    uint64_t RemoveOverflow(uint64_t id) {
+        std::lock_guard<std::mutex> lock(overflow_lock_);
+        auto it = overflow_.find(id);
+        if (it == overflow_.end()) return 0;
+        const uint64_t handle = it->second;
+        overflow_.erase(it);
+        return handle;
+    }
+
+    std::atomic<Slot *> slabs_[kSlabCount];
+    std::atomic<uint64_t> free_head_{0};
+    std::atomic<uint32_t> next_index_{0};
+    // IDs handed out once the table is full
+    std::unordered_map<uint64_t, uint64_t> overflow_;
+    uint64_t overflow_count_ = 0;
+    mutable std::mutex overflow_lock_;
+};
+
+#endif  // CHASSIS_HANDLE_TABLE_H
@@ -0,0 +1,182 @@
+/* Copyright (c) 2019 The Khronos Group Inc.
+ * Copyright (c) 2019 Valve Corporation
+ * Copyright (c) 2019 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CHASSIS_PROFILER_H
+#define CHASSIS_PROFILER_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "chassis_trace.h"
+
+// Call counts and timings for every chassis hook, per intercept and per validation object. Each thread updates its own block
+// of counters with plain relaxed stores, so recording takes no locks; Dump() merges the blocks of all threads and writes the
+// totals to the output file, as JSON if its name ends in ".json" and as CSV otherwise.
+class ChassisProfiler {
+   public:
+    // Object slots are LayerObjectTypeId values; the instance and device slots time the down-chain dispatch, recorded against the
+    // Dispatch intercept of its function
+    static const uint32_t kObjectSlotCount = 6;
+
+    ChassisProfiler(const std::string &output_path, uint32_t intercept_count, const char *const *intercept_names)
+        : output_path_(output_path), intercept_count_(intercept_count), intercept_names_(intercept_names) {}
+
+    void Record(uint32_t intercept_id, uint32_t object_slot, uint64_t elapsed_ns) {
+        Counter &counter = ThreadCounters()[intercept_id * kObjectSlotCount + object_slot];
+        counter.count.store(counter.count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        counter.total_ns.store(counter.total_ns.load(std::memory_order_relaxed) + elapsed_ns, std::memory_order_relaxed);
+        if (elapsed_ns > counter.max_ns.load(std::memory_order_relaxed)) {
+            counter.max_ns.store(elapsed_ns, std::memory_order_relaxed);
+        }
+    }
+
+    // Merge the counters of every thread and write them to the output file. Called when each device and instance is destroyed,
+    // and at any other time through the vkLayerDumpProfile entry point; every call rewrites the file with the totals so far.
+    void Dump() {
+        std::vector<Totals> totals(intercept_count_ * kObjectSlotCount);
+        {
+            std::lock_guard<std::mutex> lock(thread_blocks_lock_);
+            for (const auto &block : thread_blocks_) {
+                for (size_t i = 0; i < totals.size(); ++i) {
+                    totals[i].count += block[i].count.load(std::memory_order_relaxed);
+                    totals[i].total_ns += block[i].total_ns.load(std::memory_order_relaxed);
+                    uint64_t max_ns = block[i].max_ns.load(std::memory_order_relaxed);
+                    if (max_ns > totals[i].max_ns) totals[i].max_ns = max_ns;
+                }
+            }
+        }
+
+        const bool json = output_path_.size() >= 5 && output_path_.compare(output_path_.size() - 5, 5, ".json") == 0;
+        std::lock_guard<std::mutex> lock(dump_lock_);
+        std::ofstream output(output_path_, std::ios::out | std::ios::trunc);
+        if (!output.is_open()) return;
+        output << (json ? "[\n" : "function,hook,object,calls,total_ns,max_ns\n");
+        bool first_row = true;
+        for (uint32_t intercept_id = 0; intercept_id < intercept_count_; ++intercept_id) {
+            std::string hook;
+            std::string function;
+            SplitInterceptName(intercept_names_[intercept_id], &hook, &function);
+            for (uint32_t object_slot = 0; object_slot < kObjectSlotCount; ++object_slot) {
+                const Totals &row = totals[intercept_id * kObjectSlotCount + object_slot];
+                if (row.count == 0) continue;
+                if (json) {
+                    output << (first_row ? "" : ",\n") << "  {\"function\": \"vk" << function << "\", \"hook\": \"" << hook
+                           << "\", \"object\": \"" << ObjectName(object_slot) << "\", \"calls\": " << row.count
+                           << ", \"total_ns\": " << row.total_ns << ", \"max_ns\": " << row.max_ns << "}";
+                } else {
+                    output << "vk" << function << "," << hook << "," << ObjectName(object_slot) << "," << row.count << ","
+                           << row.total_ns << "," << row.max_ns << "\n";
+                }
+                first_row = false;
+            }
+        }
+        if (json) output << "\n]\n";
+    }
+
+    static const char *ObjectName(uint32_t object_slot) {
+        static const char *const object_names[kObjectSlotCount] = {"Chassis",         "Chassis",
+                                                                   "ThreadSafety",    "StatelessValidation",
+                                                                   "ObjectLifetimes", "CoreChecks"};
+        return object_names[object_slot];
+    }
+
+   private:
+    struct Counter {
+        std::atomic<uint64_t> count{0};
+        std::atomic<uint64_t> total_ns{0};
+        std::atomic<uint64_t> max_ns{0};
+    };
+
+    struct Totals {
+        uint64_t count = 0;
+        uint64_t total_ns = 0;
+        uint64_t max_ns = 0;
+    };
+
+    // The calling thread's counters, allocated and registered on its first use. There is one profiler per layer and it lives
+    // until the layer is unloaded, so blocks are never freed while a thread may still write to them.
+    Counter *ThreadCounters() {
+        static thread_local Counter *counters = nullptr;
+        if (!counters) {
+            std::unique_ptr<Counter[]> block(new Counter[intercept_count_ * kObjectSlotCount]);
+            counters = block.get();
+            std::lock_guard<std::mutex> lock(thread_blocks_lock_);
+            thread_blocks_.emplace_back(std::move(block));
+        }
+        return counters;
+    }
+
+    static void SplitInterceptName(const std::string &name, std::string *hook, std::string *function) {
+        static const char *const hooks[] = {"PreCallValidate", "PreCallRecord", "PostCallRecord", "Dispatch"};
+        for (const char *prefix : hooks) {
+            if (name.compare(0, strlen(prefix), prefix) == 0) {
+                *hook = prefix;
+                *function = name.substr(strlen(prefix));
+                return;
+            }
+        }
+        *function = name;
+    }
+
+    std::string output_path_;
+    uint32_t intercept_count_;
+    const char *const *intercept_names_;
+    std::vector<std::unique_ptr<Counter[]>> thread_blocks_;
+    std::mutex thread_blocks_lock_;
+    std::mutex dump_lock_;
+};
+
+// Times the enclosing scope, or until End(), against one intercept and object slot, and records it as a trace event when
+// tracing is enabled. Does nothing when neither profiling nor tracing is enabled.
+class ChassisProfileScope {
+   public:
+    ChassisProfileScope(ChassisProfiler *profiler, uint32_t intercept_id, uint32_t object_slot)
+        : profiler_(profiler), tracer_(ChassisTracer::Active()), intercept_id_(intercept_id), object_slot_(object_slot) {
+        if (profiler_ || tracer_) start_ = std::chrono::steady_clock::now();
+    }
+    ~ChassisProfileScope() { End(); }
+
+    void End() {
+        if (!profiler_ && !tracer_) return;
+        auto end = std::chrono::steady_clock::now();
+        if (profiler_) {
+            auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start_);
+            profiler_->Record(intercept_id_, object_slot_, static_cast<uint64_t>(elapsed.count()));
+        }
+        if (tracer_) {
+            tracer_->Record(tracer_->InterceptName(intercept_id_), ChassisProfiler::ObjectName(object_slot_), start_, end);
+        }
+        profiler_ = nullptr;
+        tracer_ = nullptr;
+    }
+
+   private:
+    ChassisProfiler *profiler_;
+    ChassisTracer *tracer_;
+    uint32_t intercept_id_;
+    uint32_t object_slot_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+#endif  // CHASSIS_PROFILER_H
@@ -0,0 +1,226 @@
+/* Copyright (c) 2019 The Khronos Group Inc.
+ * Copyright (c) 2019 Valve Corporation
+ * Copyright (c) 2019 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CHASSIS_TRACE_H
+#define CHASSIS_TRACE_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Trace event recorder for validation work, written in the Chrome trace-event JSON array format that chrome://tracing and
+// Perfetto load. Each thread appends complete ("X") events to its own fixed-size ring buffer without locking; a background
+// thread drains the rings into the output file. Events are dropped, and counted, while a ring is full. Timestamps come from
+// the monotonic clock so that they line up with other traces taken on the same machine. The closing ']' is left off, which the
+// format allows, so that the file is loadable at any point while the application runs.
+class ChassisTracer {
+   public:
+    static const size_t kRingCapacity = 1 << 14;
+
+    ChassisTracer(const std::string &output_path, const char *const *intercept_names)
+        : output_(output_path, std::ios::out | std::ios::trunc), intercept_names_(intercept_names) {
+        output_ << std::fixed << std::setprecision(3);
+        output_ << "[\n{\"name\": \"process_name\", \"ph\": \"M\", \"pid\": " << kProcessId
+                << ", \"args\": {\"name\": \"Vulkan validation layers\"}}";
+    }
+
+    ~ChassisTracer() {
+        Stop();
+        Flush();
+    }
+
+    // The tracer that markers report to, or null when tracing is disabled
+    static ChassisTracer *Active() { return ActiveTracer().load(std::memory_order_acquire); }
+    static void SetActive(ChassisTracer *tracer) { ActiveTracer().store(tracer, std::memory_order_release); }
+
+    // Each VkInstance holds a reference to the process-wide tracer. The first reference makes it the active tracer and starts
+    // the writer; dropping the last clears the active tracer and stops the writer, so instances that are still alive keep
+    // tracing when another one is destroyed.
+    void AddInstance() {
+        std::lock_guard<std::mutex> lock(instances_lock_);
+        if (instance_count_++ > 0) return;
+        SetActive(this);
+        Start();
+    }
+    void RemoveInstance() {
+        std::lock_guard<std::mutex> lock(instances_lock_);
+        if (instance_count_ == 0 || --instance_count_ > 0) return;
+        SetActive(nullptr);
+        Stop();
+    }
+
+    const char *InterceptName(uint32_t intercept_id) const { return intercept_names_[intercept_id]; }
+
+    // Name and category must be string literals or otherwise outlive the tracer
+    void Record(const char *name, const char *category, std::chrono::steady_clock::time_point start,
+                std::chrono::steady_clock::time_point end) {
+        ThreadRing &ring = GetThreadRing();
+        uint64_t head = ring.head.load(std::memory_order_relaxed);
+        if (head - ring.tail.load(std::memory_order_acquire) >= kRingCapacity) {
+            ring.dropped.store(ring.dropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            return;
+        }
+        Event &event = ring.events[head % kRingCapacity];
+        event.name = name;
+        event.category = category;
+        event.start = start;
+        event.end = end;
+        ring.head.store(head + 1, std::memory_order_release);
+    }
+
+    // Start the background writer, if it is not already running
+    void Start() {
+        std::lock_guard<std::mutex> lock(writer_lock_);
+        if (writer_.joinable()) return;
+        stop_writer_ = false;
+        writer_ = std::thread(&ChassisTracer::WriterLoop, this);
+    }
+
+    // Stop the background writer and write out everything recorded so far
+    void Stop() {
+        {
+            std::lock_guard<std::mutex> lock(writer_lock_);
+            if (!writer_.joinable()) return;
+            stop_writer_ = true;
+        }
+        writer_wake_.notify_one();
+        writer_.join();
+        Flush();
+    }
+
+    // Write out the events recorded so far
+    void Flush() {
+        std::lock_guard<std::mutex> flush_lock(flush_lock_);
+        std::vector<ThreadRing *> rings;
+        {
+            std::lock_guard<std::mutex> lock(rings_lock_);
+            for (const auto &ring : rings_) rings.push_back(ring.get());
+        }
+        for (auto ring : rings) {
+            uint64_t head = ring->head.load(std::memory_order_acquire);
+            uint64_t tail = ring->tail.load(std::memory_order_relaxed);
+            for (; tail != head; ++tail) {
+                const Event &event = ring->events[tail % kRingCapacity];
+                output_ << ",\n{\"name\": \"" << event.name << "\", \"cat\": \"" << event.category
+                        << "\", \"ph\": \"X\", \"pid\": " << kProcessId << ", \"tid\": " << ring->thread_index
+                        << ", \"ts\": " << Microseconds(event.start.time_since_epoch())
+                        << ", \"dur\": " << Microseconds(event.end - event.start) << "}";
+            }
+            ring->tail.store(tail, std::memory_order_release);
+            uint64_t dropped = ring->dropped.exchange(0, std::memory_order_relaxed);
+            if (dropped) {
+                output_ << ",\n{\"name\": \"Dropped trace events\", \"ph\": \"i\", \"s\": \"t\", \"pid\": " << kProcessId
+                        << ", \"tid\": " << ring->thread_index
+                        << ", \"ts\": " << Microseconds(std::chrono::steady_clock::now().time_since_epoch())
+                        << ", \"args\": {\"count\": " << dropped << "}}";
+            }
+        }
+        output_.flush();
+    }
+
+   private:
+    // Validation events go to their own process track rather than guessing at the application's process id
+    static const uint32_t kProcessId = 1;
+
+    struct Event {
+        const char *name;
+        const char *category;
+        std::chrono::steady_clock::time_point start;
+        std::chrono::steady_clock::time_point end;
+    };
+
+    struct ThreadRing {
+        std::unique_ptr<Event[]> events{new Event[kRingCapacity]};
+        std::atomic<uint64_t> head{0};
+        std::atomic<uint64_t> tail{0};
+        std::atomic<uint64_t> dropped{0};
+        uint32_t thread_index = 0;
+    };
+
+    static std::atomic<ChassisTracer *> &ActiveTracer() {
+        static std::atomic<ChassisTracer *> active_tracer{nullptr};
+        return active_tracer;
+    }
+
+    template <typename Duration>
+    static double Microseconds(Duration duration) {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count() / 1000.0;
+    }
+
+    // The calling thread's ring, allocated and registered on its first use. There is one tracer per layer and it lives until
+    // the layer is unloaded, so rings are never freed while a thread may still write to them.
+    ThreadRing &GetThreadRing() {
+        static thread_local ThreadRing *thread_ring = nullptr;
+        if (!thread_ring) {
+            std::unique_ptr<ThreadRing> ring(new ThreadRing);
+            thread_ring = ring.get();
+            std::lock_guard<std::mutex> lock(rings_lock_);
+            ring->thread_index = static_cast<uint32_t>(rings_.size()) + 1;
+            rings_.emplace_back(std::move(ring));
+        }
+        return *thread_ring;
+    }
+
+    void WriterLoop() {
+        std::unique_lock<std::mutex> lock(writer_lock_);
+        while (!stop_writer_) {
+            writer_wake_.wait_for(lock, std::chrono::milliseconds(100));
+            lock.unlock();
+            Flush();
+            lock.lock();
+        }
+    }
+
+    std::ofstream output_;
+    const char *const *intercept_names_;
+    std::vector<std::unique_ptr<ThreadRing>> rings_;
+    std::mutex rings_lock_;
+    std::mutex flush_lock_;
+    std::thread writer_;
+    std::mutex writer_lock_;
+    std::condition_variable writer_wake_;
+    bool stop_writer_ = false;
+    std::mutex instances_lock_;
+    uint32_t instance_count_ = 0;
+};
+
+// Records a trace event covering the enclosing scope. Does nothing when tracing is disabled.
+class ChassisTraceScope {
+   public:
+    ChassisTraceScope(const char *name, const char *category) : tracer_(ChassisTracer::Active()), name_(name), category_(category) {
+        if (tracer_) start_ = std::chrono::steady_clock::now();
+    }
+    ~ChassisTraceScope() {
+        if (tracer_) tracer_->Record(name_, category_, start_, std::chrono::steady_clock::now());
+    }
+
+   private:
+    ChassisTracer *tracer_;
+    const char *name_;
+    const char *category_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+#endif  // CHASSIS_TRACE_H
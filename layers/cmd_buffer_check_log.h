@@ -0,0 +1,99 @@
+/* Copyright (c) 2019 The Khronos Group Inc.
+ * Copyright (c) 2019 Valve Corporation
+ * Copyright (c) 2019 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef CMD_BUFFER_CHECK_LOG_H_
+#define CMD_BUFFER_CHECK_LOG_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+// A log of the checks a command buffer defers until it is submitted, or executed by a primary command buffer. Each check is a
+// plain record tagged with its type, stored inline in one growing buffer, so logging a check copies a few words and only
+// allocates when the buffer grows. Clearing the log keeps the buffer for the next recording of the command buffer. A record
+// may be followed by a variable number of trailing elements, such as the rectangles of a clear.
+//
+// Records are replayed in the order they were added, by switching on their type.
+template <typename Type>
+class CmdBufferCheckLog {
+   public:
+    class Record {
+       public:
+        Type type() const { return type_; }
+        template <typename T>
+        const T &Get() const {
+            return *reinterpret_cast<const T *>(this + 1);
+        }
+        // The elements that follow a record of type T
+        template <typename T, typename Element>
+        const Element *Trailing() const {
+            return reinterpret_cast<const Element *>(reinterpret_cast<const unsigned char *>(&Get<T>()) + sizeof(T));
+        }
+
+       private:
+        friend class CmdBufferCheckLog;
+        Type type_;
+        uint32_t words_;  // Size of the record, including this header, in words
+    };
+
+    class const_iterator {
+       public:
+        explicit const_iterator(const uint64_t *word) : word_(word) {}
+        const Record &operator*() const { return *reinterpret_cast<const Record *>(word_); }
+        const Record *operator->() const { return reinterpret_cast<const Record *>(word_); }
+        const_iterator &operator++() {
+            word_ += reinterpret_cast<const Record *>(word_)->words_;
+            return *this;
+        }
+        bool operator==(const const_iterator &other) const { return word_ == other.word_; }
+        bool operator!=(const const_iterator &other) const { return word_ != other.word_; }
+
+       private:
+        const uint64_t *word_;
+    };
+
+    // Append a record, with room for trailing_count elements of type Element after it. Returns the trailing elements, which
+    // stay valid until the next record is added.
+    template <typename T, typename Element = unsigned char>
+    Element *Add(Type type, const T &data, size_t trailing_count = 0) {
+        static_assert(std::is_trivially_copyable<T>::value && std::is_trivially_copyable<Element>::value,
+                      "Command buffer check records must be plain data");
+        static_assert(alignof(T) <= alignof(uint64_t) && sizeof(T) % alignof(Element) == 0,
+                      "Command buffer check records must not need padding");
+        static_assert(sizeof(Record) == sizeof(uint64_t), "Command buffer check record headers take one word");
+        const size_t words = 1 + (sizeof(T) + trailing_count * sizeof(Element) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+        const size_t offset = words_.size();
+        words_.resize(offset + words);
+        Record *record = new (&words_[offset]) Record;
+        record->type_ = type;
+        record->words_ = static_cast<uint32_t>(words);
+        T *record_data = new (record + 1) T(data);
+        return reinterpret_cast<Element *>(reinterpret_cast<unsigned char *>(record_data) + sizeof(T));
+    }
+
+    void clear() { words_.clear(); }
+    bool empty() const { return words_.empty(); }
+
+    const_iterator begin() const { return const_iterator(words_.data()); }
+    const_iterator end() const { return const_iterator(words_.data() + words_.size()); }
+
+   private:
+    std::vector<uint64_t> words_;
+};
+
+#endif  // CMD_BUFFER_CHECK_LOG_H_
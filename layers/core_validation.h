@@ -32,6 +32,7 @@
 #include "vulkan/vk_layer.h"
 #include "vk_typemap_helper.h"
 #include "vk_layer_data.h"
+#include "state_object_table.h"
 #include <atomic>
 #include <functional>
 #include <memory>
@@ -168,11 +169,14 @@ struct GpuValidationState;
 
 class CoreChecks : public ValidationObject {
    public:
-    unordered_map<VkSampler, std::unique_ptr<SAMPLER_STATE>> samplerMap;
-    unordered_map<VkImageView, std::unique_ptr<IMAGE_VIEW_STATE>> imageViewMap;
-    unordered_map<VkImage, std::unique_ptr<IMAGE_STATE>> imageMap;
-    unordered_map<VkBufferView, std::unique_ptr<BUFFER_VIEW_STATE>> bufferViewMap;
-    unordered_map<VkBuffer, std::unique_ptr<BUFFER_STATE>> bufferMap;
+    // Declared ahead of the state object tables, as the state objects release their lifetime IDs when they are destroyed
+    BindingLifetimes binding_lifetimes;
+    // The tables for objects that applications create and destroy at high rates keep their state objects in slab pools
+    StateObjectTable<VkSampler, SAMPLER_STATE> samplerMap;
+    StateObjectTable<VkImageView, IMAGE_VIEW_STATE> imageViewMap;
+    StateObjectTable<VkImage, IMAGE_STATE> imageMap;
+    StateObjectTable<VkBufferView, BUFFER_VIEW_STATE> bufferViewMap;
+    StateObjectTable<VkBuffer, BUFFER_STATE> bufferMap;
     unordered_map<VkPipeline, std::unique_ptr<PIPELINE_STATE>> pipelineMap;
     unordered_map<VkDeviceMemory, std::unique_ptr<DEVICE_MEMORY_STATE>> memObjMap;
     unordered_map<VkFramebuffer, std::unique_ptr<FRAMEBUFFER_STATE>> frameBufferMap;
@@ -180,8 +184,8 @@ class CoreChecks : public ValidationObject {
     unordered_map<VkDescriptorUpdateTemplateKHR, std::unique_ptr<TEMPLATE_STATE>> desc_template_map;
     unordered_map<VkSwapchainKHR, std::unique_ptr<SWAPCHAIN_NODE>> swapchainMap;
     unordered_map<VkDescriptorPool, std::unique_ptr<DESCRIPTOR_POOL_STATE>> descriptorPoolMap;
-    unordered_map<VkDescriptorSet, std::unique_ptr<cvdescriptorset::DescriptorSet>> setMap;
-    unordered_map<VkCommandBuffer, std::unique_ptr<CMD_BUFFER_STATE>> commandBufferMap;
+    StateObjectTable<VkDescriptorSet, cvdescriptorset::DescriptorSet> setMap;
+    StateObjectTable<VkCommandBuffer, CMD_BUFFER_STATE> commandBufferMap;
     unordered_map<VkCommandPool, std::unique_ptr<COMMAND_POOL_STATE>> commandPoolMap;
     unordered_map<VkPipelineLayout, std::unique_ptr<PIPELINE_LAYOUT_STATE>> pipelineLayoutMap;
     unordered_map<VkFence, std::unique_ptr<FENCE_STATE>> fenceMap;
@@ -235,6 +239,8 @@ class CoreChecks : public ValidationObject {
     std::unique_ptr<GpuValidationState> gpu_validation_state;
     uint32_t physical_device_count;
 
+    command_buffer_lock_guard_t command_buffer_write_lock(VkCommandBuffer command_buffer);
+
     // Class Declarations for helper functions
     cvdescriptorset::DescriptorSet* GetSetNode(VkDescriptorSet);
     DESCRIPTOR_POOL_STATE* GetDescriptorPoolState(const VkDescriptorPool);
@@ -284,7 +290,6 @@ class CoreChecks : public ValidationObject {
     bool ValidateDeviceQueueFamily(uint32_t queue_family, const char* cmd_name, const char* parameter_name, const char* error_code,
                                    bool optional);
     BASE_NODE* GetStateStructPtrFromObject(VK_OBJECT object_struct);
-    void RemoveCommandBufferBinding(VK_OBJECT const* object, CMD_BUFFER_STATE* cb_node);
     bool ValidateBindBufferMemory(VkBuffer buffer, VkDeviceMemory mem, VkDeviceSize memoryOffset, const char* api_name);
     void RecordGetBufferMemoryRequirementsState(VkBuffer buffer, VkMemoryRequirements* pMemoryRequirements);
     void UpdateBindBufferMemoryState(VkBuffer buffer, VkDeviceMemory mem, VkDeviceSize memoryOffset);
@@ -365,8 +370,8 @@ class CoreChecks : public ValidationObject {
                                          const VkWriteDescriptorSet* pDescriptorWrites);
     void UpdateLastBoundDescriptorSets(CMD_BUFFER_STATE* cb_state, VkPipelineBindPoint pipeline_bind_point,
                                        const PIPELINE_LAYOUT_STATE* pipeline_layout, uint32_t first_set, uint32_t set_count,
-                                       const std::vector<cvdescriptorset::DescriptorSet*> descriptor_sets,
-                                       uint32_t dynamic_offset_count, const uint32_t* p_dynamic_offsets);
+                                       cvdescriptorset::DescriptorSet* const* descriptor_sets, uint32_t dynamic_offset_count,
+                                       const uint32_t* p_dynamic_offsets);
     bool ValidatePipelineBindPoint(CMD_BUFFER_STATE* cb_state, VkPipelineBindPoint bind_point, const char* func_name,
                                    const std::map<VkPipelineBindPoint, std::string>& bind_errors);
     bool ValidateMemoryIsMapped(const char* funcName, uint32_t memRangeCount, const VkMappedMemoryRange* pMemRanges);
@@ -495,7 +500,15 @@ class CoreChecks : public ValidationObject {
     void AddCommandBufferBindingBuffer(CMD_BUFFER_STATE*, BUFFER_STATE*);
     void AddCommandBufferBindingBufferView(CMD_BUFFER_STATE*, BUFFER_VIEW_STATE*);
     bool ValidateObjectNotInUse(BASE_NODE* obj_node, VK_OBJECT obj_struct, const char* caller_name, const char* error_code);
+    bool AddBoundObject(CMD_BUFFER_STATE* cb_node, BASE_NODE* base_node, VK_OBJECT obj);
+    void AddCommandBufferBinding(BASE_NODE* base_node, VK_OBJECT obj, CMD_BUFFER_STATE* cb_node);
+    void InvalidateCommandBuffer(CMD_BUFFER_STATE* cb_node, VK_OBJECT obj);
     void InvalidateCommandBuffers(std::unordered_set<CMD_BUFFER_STATE*> const& cb_nodes, VK_OBJECT obj);
+    bool HasStaleBindings(const CMD_BUFFER_STATE* cb_node) const;
+    void InvalidateStaleBindings(CMD_BUFFER_STATE* cb_node);
+    bool ValidateSubmitChecks(VkQueue queue, CMD_BUFFER_STATE* cb_node);
+    bool ValidateSubmitQueryChecks(VkQueue queue, CMD_BUFFER_STATE* cb_node);
+    bool ValidateExecuteChecks(const CMD_BUFFER_STATE* cb_state, const CMD_BUFFER_STATE* sub_cb_state, VkFramebuffer fb);
     void RemoveImageMemoryRange(uint64_t handle, DEVICE_MEMORY_STATE* mem_info);
     void RemoveBufferMemoryRange(uint64_t handle, DEVICE_MEMORY_STATE* mem_info);
     void ClearMemoryObjectBindings(uint64_t handle, VulkanObjectType type);
@@ -1164,6 +1177,7 @@ class CoreChecks : public ValidationObject {
     bool PreCallValidateBeginCommandBuffer(VkCommandBuffer commandBuffer, const VkCommandBufferBeginInfo* pBeginInfo);
     void PreCallRecordBeginCommandBuffer(VkCommandBuffer commandBuffer, const VkCommandBufferBeginInfo* pBeginInfo);
     bool PreCallValidateEndCommandBuffer(VkCommandBuffer commandBuffer);
+    void PreCallRecordEndCommandBuffer(VkCommandBuffer commandBuffer);
     void PostCallRecordEndCommandBuffer(VkCommandBuffer commandBuffer, VkResult result);
     bool PreCallValidateResetCommandBuffer(VkCommandBuffer commandBuffer, VkCommandBufferResetFlags flags);
     void PostCallRecordResetCommandBuffer(VkCommandBuffer commandBuffer, VkCommandBufferResetFlags flags, VkResult result);
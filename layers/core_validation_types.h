@@ -27,6 +27,9 @@
 
 #include "hash_vk_types.h"
 #include "sparse_containers.h"
+#include "chassis_handle_table.h"
+#include "cmd_buffer_check_log.h"
+#include "bind_point_state.h"
 #include "vk_safe_struct.h"
 #include "vulkan/vulkan.h"
 #include "vk_layer_logging.h"
@@ -42,6 +45,7 @@
 #include <list>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <string.h>
 #include <unordered_map>
@@ -70,6 +74,33 @@ enum CALL_STATE {
     QUERY_DETAILS,  // Function called w/ a count to query details
 };
 
+// Lifetime IDs identify objects bound to command buffers when command buffers are invalidated lazily. An object's ID is
+// assigned when the object is first bound and stops being live when the object is destroyed, so command buffers can tell
+// that an object they bound is gone without dereferencing it. Each device hands out IDs for its own objects.
+class BindingLifetimes {
+   public:
+    uint64_t Get(BASE_NODE *base_node);
+    bool IsLive(uint64_t lifetime_id) const { return ids_.Unwrap(lifetime_id) != 0; }
+    // The state object of a live ID, or null once the object is destroyed
+    BASE_NODE *Find(uint64_t lifetime_id) const { return reinterpret_cast<BASE_NODE *>(ids_.Unwrap(lifetime_id)); }
+    void Release(uint64_t lifetime_id) {
+        ids_.Remove(lifetime_id);
+        CountChange();
+    }
+    // Counts destructions and updates of the device's objects with lifetime IDs. Command buffers only look for stale
+    // bindings when this has moved on since they last looked.
+    void CountChange() { change_count_.fetch_add(1, std::memory_order_release); }
+    uint64_t ChangeCount() const { return change_count_.load(std::memory_order_acquire); }
+    // Numbers each recording of the device's command buffers, starting at 1
+    uint64_t NextRecordingId() { return recording_count_.fetch_add(1, std::memory_order_relaxed) + 1; }
+
+   private:
+    // Stores the state object each ID was handed out for
+    WrappedHandleTable ids_;
+    std::atomic<uint64_t> change_count_{0};
+    std::atomic<uint64_t> recording_count_{0};
+};
+
 class BASE_NODE {
    public:
     // Track when object is being used by an in-flight command buffer
@@ -78,17 +109,36 @@ class BASE_NODE {
     //  binding initialized when cmd referencing object is bound to command buffer
     //  binding removed when command buffer is reset or destroyed
     // When an object is destroyed, any bound cbs are set to INVALID
+    // Left empty when command buffers are invalidated lazily
     std::unordered_set<CMD_BUFFER_STATE *> cb_bindings;
-
-    BASE_NODE() { in_use.store(0); };
+    // Lifetime ID of the object, or zero until it is bound to a command buffer with lazy invalidation, and the device table
+    // the ID comes from
+    std::atomic<uint64_t> lifetime_id;
+    std::atomic<BindingLifetimes *> lifetimes;
+    // Recording ID of the command buffer that last bound the object with lazy invalidation, or zero
+    std::atomic<uint64_t> last_binding_recording;
+    // Bumped when an update invalidates the command buffers the object is bound to
+    uint32_t update_count;
+
+    BASE_NODE() : lifetime_id(0), lifetimes(nullptr), last_binding_recording(0), update_count(0) { in_use.store(0); };
+    ~BASE_NODE() {
+        const uint64_t id = lifetime_id.load();
+        if (id) lifetimes.load()->Release(id);
+    }
 };
 
+// Add cb_node to an object's cb_bindings. Command buffers recorded concurrently under per-command-buffer locking can
+// bind the same object, so the insertion is serialized on a lock selected by the address of the binding set.
+void InsertCommandBufferBinding(std::unordered_set<CMD_BUFFER_STATE *> *cb_bindings, CMD_BUFFER_STATE *cb_node);
+
 // Track command pools and their command buffers
 struct COMMAND_POOL_STATE : public BASE_NODE {
     VkCommandPoolCreateFlags createFlags;
     uint32_t queueFamilyIndex;
     // Cmd buffers allocated from this pool
     std::unordered_set<VkCommandBuffer> commandBuffers;
+    // Held while recording state for a command buffer from this pool with per-command-buffer locking enabled
+    std::mutex recording_lock;
 };
 
 // Utilities for barriers and the commmand pool
@@ -126,6 +176,18 @@ struct hash<VK_OBJECT> {
 };
 }  // namespace std
 
+// An object bound to a command buffer. With lazy invalidation, the object's lifetime ID and update count when it was bound are
+// kept so that later checks can find out whether it has since been destroyed or updated; otherwise both are zero.
+struct CB_BOUND_OBJECT {
+    BASE_NODE *node;
+    VK_OBJECT object;
+    uint64_t lifetime_id;
+    uint32_t update_count;
+};
+
+// Drop an object that is being destroyed from the bound objects of the command buffers in its cb_bindings.
+void RemoveBoundObjectFromCommandBuffers(BASE_NODE *base_node, VK_OBJECT obj);
+
 // Flags describing requirements imposed by the pipeline on a descriptor. These
 // can't be checked at pipeline creation time as they depend on the Image or
 // ImageView bound.
@@ -1238,8 +1300,9 @@ struct LAST_BOUND_STATE {
     // Ordered bound set tracking where index is set# that given set is bound to
     std::vector<cvdescriptorset::DescriptorSet *> boundDescriptorSets;
     std::unique_ptr<cvdescriptorset::DescriptorSet> push_descriptor_set;
-    // one dynamic offset per dynamic descriptor bound to this CB
-    std::vector<std::vector<uint32_t>> dynamicOffsets;
+    // one dynamic offset per dynamic descriptor bound to this CB, kept in the CB's dynamic_offset_arena. This may be longer
+    // than boundDescriptorSets, so that set indices keep their room in the arena when they are disturbed and bound again.
+    std::vector<DynamicOffsetRange> dynamicOffsets;
     std::vector<PipelineLayoutCompatId> compat_id_for_set;
 
     void reset() {
@@ -1380,6 +1443,78 @@ struct QFOTransferCBScoreboards {
     QFOTransferCBScoreboard<Barrier> release;
 };
 
+// Records of the checks a command buffer defers to later calls, and the state each check needs
+namespace cb_check {
+enum Type : uint32_t {
+    // Run when the command buffer is submitted
+    kSetEventStageMask,
+    kValidateEventStageMask,
+    kValidateQFOTransferQueue,
+    // Run when the command buffer, or a primary command buffer that executes it, is submitted
+    kSetQueryState,
+    kValidateQuery,
+    kExecuteCommands,
+    // Run when a primary command buffer executes the secondary command buffer
+    kValidateImageBarrierImage,
+    kValidateClearAttachmentExtent,
+};
+
+struct SetEventStageMask {
+    VkEvent event;
+    VkPipelineStageFlags stage_mask;
+};
+
+struct ValidateEventStageMask {
+    size_t first_event_index;
+    uint32_t event_count;
+    VkPipelineStageFlags source_stage_mask;
+};
+
+struct ValidateQFOTransferQueue {
+    const char *func_name;
+    uint64_t barrier_handle;
+    const std::string *val_codes;
+    VkSharingMode sharing_mode;
+    VulkanObjectType object_type;
+    uint32_t src_queue_family;
+    uint32_t dst_queue_family;
+};
+
+struct SetQueryState {
+    QueryObject query;
+    bool value;
+};
+
+struct ValidateQuery {
+    VkQueryPool query_pool;
+    uint32_t first_query;
+    uint32_t query_count;
+};
+
+// The query checks of a secondary command buffer, which is referenced rather than copied into the primary
+struct ExecuteCommands {
+    VkCommandBuffer command_buffer;
+};
+
+// The render pass is kept by lifetime ID, so that a destroyed render pass, or another one given the same handle, is not mistaken
+// for it
+struct ValidateImageBarrierImage {
+    const char *func_name;
+    VkRenderPass render_pass;
+    uint64_t render_pass_id;
+    uint32_t active_subpass;
+    uint32_t img_index;
+    VkImageMemoryBarrier img_barrier;
+};
+
+// Followed by rect_count VkClearRects
+struct ValidateClearAttachmentExtent {
+    uint32_t attachment_index;
+    uint32_t fb_attachment;
+    uint32_t rect_count;
+};
+}  // namespace cb_check
+
 // Cmd Buffer Wrapper Struct - TODO : This desperately needs its own class
 struct CMD_BUFFER_STATE : public BASE_NODE {
     VkCommandBuffer commandBuffer;
@@ -1398,8 +1533,9 @@ struct CMD_BUFFER_STATE : public BASE_NODE {
     // Currently storing "lastBound" objects on per-CB basis
     //  long-term may want to create caches of "lastBound" states and could have
     //  each individual CMD_NODE referencing its own "lastBound" state
-    // Store last bound state for Gfx & Compute pipeline bind points
-    std::map<uint32_t, LAST_BOUND_STATE> lastBound;
+    // Store last bound state for Gfx, Compute & Ray Tracing pipeline bind points
+    BindPointArray<LAST_BOUND_STATE> lastBound;
+    DynamicOffsetArena dynamic_offset_arena;
 
     uint32_t viewportMask;
     uint32_t scissorMask;
@@ -1414,7 +1550,16 @@ struct CMD_BUFFER_STATE : public BASE_NODE {
     std::unordered_set<VkFramebuffer> framebuffers;
     // Unified data structs to track objects bound to this command buffer as well as object
     //  dependencies that have been broken : either destroyed objects, or updated descriptor sets
-    std::unordered_set<VK_OBJECT> object_bindings;
+    //  object_bindings maps each bound object to its index in bound_objects
+    std::unordered_map<VK_OBJECT, size_t> object_bindings;
+    // State of each object in object_bindings, resolved when it is bound so that submit and retire can update in_use
+    //  without looking the handles up again
+    std::vector<CB_BOUND_OBJECT> bound_objects;
+    // With lazy invalidation, the ID of the current recording, and whether bound_objects had stale bindings as of the device's
+    //  ChangeCount() when they were last looked through. A stale binding stays stale until InvalidateStaleBindings.
+    uint64_t recording_id = 0;
+    mutable uint64_t stale_check_change_count = 0;
+    mutable bool has_stale_bindings = false;
     std::vector<VK_OBJECT> broken_bindings;
 
     QFOTransferBarrierSets<VkBufferMemoryBarrier> qfo_transfer_buffer_barriers;
@@ -1440,19 +1585,20 @@ struct CMD_BUFFER_STATE : public BASE_NODE {
     // If primary, the secondary command buffers we will call.
     // If secondary, the primary command buffers we will be called by.
     std::unordered_set<CMD_BUFFER_STATE *> linkedCommandBuffers;
-    // Validation functions run at primary CB queue submit time
-    std::vector<std::function<bool()>> queue_submit_functions;
-    // Validation functions run when secondary CB is executed in primary
-    std::vector<std::function<bool(CMD_BUFFER_STATE *, VkFramebuffer)>> cmd_execute_commands_functions;
+    // Checks run at queue submit time
+    CmdBufferCheckLog<cb_check::Type> submit_checks;
+    // Checks run when secondary CB is executed in primary
+    CmdBufferCheckLog<cb_check::Type> execute_checks;
     std::unordered_set<VkDeviceMemory> memObjs;
-    std::vector<std::function<bool(VkQueue)>> eventUpdates;
-    std::vector<std::function<bool(VkQueue)>> queryUpdates;
     std::unordered_set<cvdescriptorset::DescriptorSet *> validated_descriptor_sets;
     // Contents valid only after an index buffer is bound (CBSTATUS_INDEX_BUFFER_BOUND set)
     IndexBufferBinding index_buffer_binding;
 
     // Cache of current insert label...
     LoggingLabel debug_label;
+
+    // Remove bound_objects[index] and its object_bindings entry, moving the last bound object into its place
+    void RemoveBoundObject(size_t index);
 };
 
 static inline QFOTransferBarrierSets<VkImageMemoryBarrier> &GetQFOBarrierSets(
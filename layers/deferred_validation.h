@@ -0,0 +1,145 @@
+/* Copyright (c) 2019 The Khronos Group Inc.
+ * Copyright (c) 2019 Valve Corporation
+ * Copyright (c) 2019 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DEFERRED_VALIDATION_H
+#define DEFERRED_VALIDATION_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Worker pool that runs the validation and state-recording hooks of deferrable entry points off the application thread.
+//
+// Jobs are sharded by key (the command buffer), so all work for one command buffer runs in submission order on a single
+// worker. Barrier jobs are ordered against every shard: they run once all previously enqueued jobs have finished and before
+// any job enqueued after them starts. Entry points that are not deferred but release, reset, wait on or update objects
+// Drain() the pool first, so they observe the state recorded by all earlier calls.
+class DeferredValidation {
+   public:
+    explicit DeferredValidation(uint32_t thread_count) : workers_(thread_count ? thread_count : 1) {
+        for (auto &worker : workers_) {
+            worker.thread = std::thread(&DeferredValidation::WorkerLoop, this, &worker);
+        }
+    }
+
+    ~DeferredValidation() {
+        Drain();
+        for (auto &worker : workers_) {
+            {
+                std::lock_guard<std::mutex> lock(worker.lock);
+                worker.stop = true;
+            }
+            worker.wake.notify_one();
+        }
+        for (auto &worker : workers_) {
+            worker.thread.join();
+        }
+    }
+
+    // Run job after all jobs previously enqueued for the same key
+    void Enqueue(const void *key, std::function<void()> job) {
+        pending_.fetch_add(1, std::memory_order_relaxed);
+        auto &worker = workers_[(reinterpret_cast<uintptr_t>(key) >> 4) % workers_.size()];
+        {
+            std::lock_guard<std::mutex> lock(worker.lock);
+            worker.jobs.emplace_back(std::move(job));
+        }
+        worker.wake.notify_one();
+    }
+
+    // Run job after all previously enqueued jobs, holding back every job enqueued after it
+    void EnqueueBarrier(std::function<void()> job) { InsertBarrier(std::move(job)); }
+
+    // Block until every previously enqueued job has finished
+    void Drain() {
+        if (pending_.load(std::memory_order_acquire) == 0) return;
+        auto barrier = InsertBarrier(nullptr);
+        std::unique_lock<std::mutex> lock(barrier->lock);
+        barrier->finished.wait(lock, [&barrier] { return barrier->done; });
+    }
+
+   private:
+    struct Worker {
+        std::mutex lock;
+        std::condition_variable wake;
+        std::deque<std::function<void()>> jobs;
+        bool stop = false;
+        std::thread thread;
+    };
+
+    struct Barrier {
+        std::atomic<size_t> remaining;
+        std::function<void()> job;
+        std::mutex lock;
+        std::condition_variable finished;
+        bool done = false;
+    };
+
+    std::shared_ptr<Barrier> InsertBarrier(std::function<void()> job) {
+        auto barrier = std::make_shared<Barrier>();
+        barrier->remaining.store(workers_.size());
+        barrier->job = std::move(job);
+        // Every worker reaches the barrier; the last to arrive runs its job and releases the others. Barriers must reach all
+        // workers in the same order, or two of them could each hold a worker the other is waiting for.
+        std::lock_guard<std::mutex> order_lock(barrier_order_lock_);
+        for (auto &worker : workers_) {
+            pending_.fetch_add(1, std::memory_order_relaxed);
+            {
+                std::lock_guard<std::mutex> lock(worker.lock);
+                worker.jobs.emplace_back([barrier]() {
+                    if (barrier->remaining.fetch_sub(1) == 1) {
+                        if (barrier->job) barrier->job();
+                        std::lock_guard<std::mutex> lock(barrier->lock);
+                        barrier->done = true;
+                        barrier->finished.notify_all();
+                    } else {
+                        std::unique_lock<std::mutex> lock(barrier->lock);
+                        barrier->finished.wait(lock, [&barrier] { return barrier->done; });
+                    }
+                });
+            }
+            worker.wake.notify_one();
+        }
+        return barrier;
+    }
+
+    void WorkerLoop(Worker *worker) {
+        std::unique_lock<std::mutex> lock(worker->lock);
+        while (true) {
+            worker->wake.wait(lock, [worker] { return worker->stop || !worker->jobs.empty(); });
+            if (worker->jobs.empty()) return;
+            auto job = std::move(worker->jobs.front());
+            worker->jobs.pop_front();
+            lock.unlock();
+            job();
+            pending_.fetch_sub(1, std::memory_order_release);
+            lock.lock();
+        }
+    }
+
+    std::vector<Worker> workers_;
+    std::atomic<uint64_t> pending_{0};
+    std::mutex barrier_order_lock_;
+};
+
+#endif  // DEFERRED_VALIDATION_H
@@ -29,6 +29,7 @@
 #include "vk_object_types.h"
 #include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <unordered_map>
 #include <unordered_set>
@@ -488,7 +489,7 @@ class DescriptorSet : public BASE_NODE {
     // Is this set compatible with the given layout?
     bool IsCompatible(DescriptorSetLayout const *const, std::string *) const;
     // For given bindings validate state at time of draw is correct, returning false on error and writing error details into string*
-    bool ValidateDrawState(const std::map<uint32_t, descriptor_req> &, const std::vector<uint32_t> &, CMD_BUFFER_STATE *,
+    bool ValidateDrawState(const std::map<uint32_t, descriptor_req> &, const uint32_t *dynamic_offsets, CMD_BUFFER_STATE *,
                            const char *caller, std::string *) const;
     // For given set of bindings, add any buffers and images that will be updated to their respective unordered_sets & return number
     // of objects inserted
@@ -530,9 +531,13 @@ class DescriptorSet : public BASE_NODE {
     void FilterAndTrackBindingReqs(CMD_BUFFER_STATE *, const BindingReqMap &in_req, BindingReqMap *out_req);
     void FilterAndTrackBindingReqs(CMD_BUFFER_STATE *, PIPELINE_STATE *, const BindingReqMap &in_req, BindingReqMap *out_req);
     void ClearCachedDynamicDescriptorValidation(CMD_BUFFER_STATE *cb_state) {
+        std::lock_guard<std::mutex> lock(cached_validation_mutex_);
         cached_validation_[cb_state].dynamic_buffers.clear();
     }
-    void ClearCachedValidation(CMD_BUFFER_STATE *cb_state) { cached_validation_.erase(cb_state); }
+    void ClearCachedValidation(CMD_BUFFER_STATE *cb_state) {
+        std::lock_guard<std::mutex> lock(cached_validation_mutex_);
+        cached_validation_.erase(cb_state);
+    }
     // If given cmd_buffer is in the cb_bindings set, remove it
     void RemoveBoundCommandBuffer(CMD_BUFFER_STATE *cb_node) {
         cb_bindings.erase(cb_node);
@@ -599,6 +604,8 @@ class DescriptorSet : public BASE_NODE {
     typedef std::unordered_map<CMD_BUFFER_STATE *, CachedValidation> CachedValidationMap;
     // Image and ImageView bindings are validated per pipeline and not invalidate by repeated binding
     CachedValidationMap cached_validation_;
+    // Draw-time validation runs under a shared lock and may update the cache for different command buffers concurrently
+    std::mutex cached_validation_mutex_;
 };
 // For the "bindless" style resource usage with many descriptors, need to optimize binding and validation
 class PrefilterBindRequestMap {
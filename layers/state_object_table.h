@@ -0,0 +1,241 @@
+/* Copyright (c) 2019 The Khronos Group Inc.
+ * Copyright (c) 2019 Valve Corporation
+ * Copyright (c) 2019 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef STATE_OBJECT_TABLE_H_
+#define STATE_OBJECT_TABLE_H_
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+// Allocates state objects of one type from fixed-size slabs. Deleted objects go on a free list and their storage is reused by
+// the next New, so creating and destroying objects at a steady rate does not touch the heap. Slabs are only released when the
+// pool is destroyed. Not thread safe.
+template <typename T>
+class StateObjectPool {
+   public:
+    StateObjectPool() = default;
+    StateObjectPool(const StateObjectPool &) = delete;
+    StateObjectPool &operator=(const StateObjectPool &) = delete;
+
+    template <typename... Args>
+    T *New(Args &&... args) {
+        Slot *slot = free_list_;
+        if (slot) {
+            free_list_ = slot->next;
+        } else {
+            slot = AllocateSlot();
+        }
+        return new (slot->storage) T(std::forward<Args>(args)...);
+    }
+
+    void Delete(T *object) {
+        object->~T();
+        Slot *slot = reinterpret_cast<Slot *>(object);
+        slot->next = free_list_;
+        free_list_ = slot;
+    }
+
+   private:
+    union Slot {
+        Slot *next;
+        alignas(T) unsigned char storage[sizeof(T)];
+    };
+    // Aim for 64KB slabs, but keep at least a few objects in each slab for the larger state types
+    static const size_t kSlabSize = sizeof(Slot) * 8 < 64 * 1024 ? (64 * 1024) / sizeof(Slot) : 8;
+
+    Slot *AllocateSlot() {
+        if (slabs_.empty() || slab_used_ == kSlabSize) {
+            slabs_.emplace_back(new Slot[kSlabSize]);
+            slab_used_ = 0;
+        }
+        return &slabs_.back()[slab_used_++];
+    }
+
+    std::vector<std::unique_ptr<Slot[]>> slabs_;
+    size_t slab_used_ = 0;
+    Slot *free_list_ = nullptr;
+};
+
+static inline uint64_t StateObjectTableKey(uint64_t handle) { return handle; }
+template <typename T>
+static inline uint64_t StateObjectTableKey(T *handle) {
+    return reinterpret_cast<uintptr_t>(handle);
+}
+
+// Maps Vulkan handles to the state objects the table owns. Entries are kept in a single open-addressing array with linear
+// probing, so a lookup is a multiplicative hash and, usually, one cache line. Erase shifts the following entries back rather
+// than leaving tombstones, which keeps probe lengths short under heavy create/destroy churn. The state objects themselves are
+// allocated from a StateObjectPool. Pointers to state objects stay valid until their handle is erased; iterators are
+// invalidated by Emplace and erase.
+//
+// Like the unordered_maps it replaces, the table must only be modified while the validation object lock is held exclusively.
+// Lookups may run concurrently with each other only as long as nothing calls Emplace while the lock is shared: Emplace can
+// grow and rehash the table under a concurrent lookup.
+template <typename Handle, typename State>
+class StateObjectTable {
+   public:
+    struct Entry {
+        Handle first;
+        State *second;
+    };
+
+    template <typename EntryType>
+    class Iterator {
+       public:
+        Iterator(EntryType *entry, EntryType *end) : entry_(entry), end_(end) { SkipEmpty(); }
+        EntryType &operator*() const { return *entry_; }
+        EntryType *operator->() const { return entry_; }
+        Iterator &operator++() {
+            ++entry_;
+            SkipEmpty();
+            return *this;
+        }
+        bool operator==(const Iterator &other) const { return entry_ == other.entry_; }
+        bool operator!=(const Iterator &other) const { return entry_ != other.entry_; }
+
+       private:
+        void SkipEmpty() {
+            while (entry_ != end_ && !StateObjectTableKey(entry_->first)) ++entry_;
+        }
+        EntryType *entry_;
+        EntryType *end_;
+    };
+    typedef Iterator<Entry> iterator;
+    typedef Iterator<const Entry> const_iterator;
+
+    StateObjectTable() = default;
+    StateObjectTable(const StateObjectTable &) = delete;
+    StateObjectTable &operator=(const StateObjectTable &) = delete;
+    ~StateObjectTable() { clear(); }
+
+    // The state object of a handle, or nullptr if the handle is not in the table
+    State *Get(Handle handle) const {
+        const uint64_t key = StateObjectTableKey(handle);
+        if (!key || entries_.empty()) return nullptr;
+        for (size_t index = Home(key);; index = (index + 1) & mask_) {
+            const Entry &entry = entries_[index];
+            const uint64_t entry_key = StateObjectTableKey(entry.first);
+            if (entry_key == key) return entry.second;
+            if (!entry_key) return nullptr;
+        }
+    }
+
+    // Construct the state object for a handle, replacing and destroying any state object the handle already had
+    template <typename... Args>
+    State *Emplace(Handle handle, Args &&... args) {
+        const uint64_t key = StateObjectTableKey(handle);
+        assert(key);
+        if ((size_ + 1) * 2 > entries_.size()) Grow();
+        State *state = pool_.New(std::forward<Args>(args)...);
+        size_t index = Home(key);
+        for (;; index = (index + 1) & mask_) {
+            const uint64_t entry_key = StateObjectTableKey(entries_[index].first);
+            if (!entry_key) break;
+            if (entry_key == key) {
+                State *old_state = entries_[index].second;
+                entries_[index].second = state;
+                pool_.Delete(old_state);
+                return state;
+            }
+        }
+        entries_[index].first = handle;
+        entries_[index].second = state;
+        size_++;
+        return state;
+    }
+
+    // Remove a handle and destroy its state object. The handle is out of the table before the state object's destructor runs.
+    bool erase(Handle handle) {
+        const uint64_t key = StateObjectTableKey(handle);
+        if (!key || entries_.empty()) return false;
+        size_t hole = Home(key);
+        for (;; hole = (hole + 1) & mask_) {
+            const uint64_t entry_key = StateObjectTableKey(entries_[hole].first);
+            if (entry_key == key) break;
+            if (!entry_key) return false;
+        }
+        State *state = entries_[hole].second;
+        // Move back each following entry of the probe run that may occupy the hole, so that lookups never see a gap
+        for (size_t index = (hole + 1) & mask_; StateObjectTableKey(entries_[index].first); index = (index + 1) & mask_) {
+            const size_t home = Home(StateObjectTableKey(entries_[index].first));
+            if (((index - home) & mask_) >= ((index - hole) & mask_)) {
+                entries_[hole] = entries_[index];
+                hole = index;
+            }
+        }
+        entries_[hole] = Entry{};
+        size_--;
+        pool_.Delete(state);
+        return true;
+    }
+
+    void clear() {
+        std::vector<Entry> entries;
+        entries.swap(entries_);
+        size_ = 0;
+        mask_ = 0;
+        shift_ = 64;
+        for (auto &entry : entries) {
+            if (StateObjectTableKey(entry.first)) pool_.Delete(entry.second);
+        }
+    }
+
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+    iterator begin() { return iterator(entries_.data(), entries_.data() + entries_.size()); }
+    iterator end() { return iterator(entries_.data() + entries_.size(), entries_.data() + entries_.size()); }
+    const_iterator begin() const { return const_iterator(entries_.data(), entries_.data() + entries_.size()); }
+    const_iterator end() const {
+        return const_iterator(entries_.data() + entries_.size(), entries_.data() + entries_.size());
+    }
+
+   private:
+    static const size_t kMinCapacity = 64;
+
+    // Fibonacci hashing: handles are often aligned pointers or sequential IDs, and the multiply spreads both across the
+    // high bits that select the home slot
+    size_t Home(uint64_t key) const { return static_cast<size_t>((key * 0x9e3779b97f4a7c15ull) >> shift_); }
+
+    void Grow() {
+        const size_t capacity = entries_.empty() ? kMinCapacity : entries_.size() * 2;
+        std::vector<Entry> entries(capacity);
+        entries.swap(entries_);
+        mask_ = capacity - 1;
+        shift_ = 64;
+        for (size_t bits = capacity; bits > 1; bits >>= 1) shift_--;
+        for (auto &entry : entries) {
+            const uint64_t key = StateObjectTableKey(entry.first);
+            if (!key) continue;
+            size_t index = Home(key);
+            while (StateObjectTableKey(entries_[index].first)) index = (index + 1) & mask_;
+            entries_[index] = entry;
+        }
+    }
+
+    std::vector<Entry> entries_;
+    size_t size_ = 0;
+    size_t mask_ = 0;
+    unsigned shift_ = 64;
+    StateObjectPool<State> pool_;
+};
+
+#endif  // STATE_OBJECT_TABLE_H_
@@ -20,8 +20,13 @@
 #ifndef LAYER_DATA_H
 #define LAYER_DATA_H
 
+#include <atomic>
 #include <cassert>
+#include <cstdint>
+#include <memory>
+#include <mutex>
 #include <unordered_map>
+#include <vector>
 
 // For the given data key, look up the layer_data instance from given layer_data_map
 template <typename DATA_T>
@@ -51,4 +56,191 @@ void FreeLayerDataPtr(void *data_key, std::unordered_map<void *, DATA_T *> &laye
     layer_data_map.erase(got);
 }
 
+// Table of layer data keyed by dispatch key, read without locking by every intercepted call. Entries are only added and removed
+// at instance and device creation and destruction; those serialize on an internal mutex and publish slots with release stores.
+// Lookups probe an open-addressed array with acquire loads. Removed slots become tombstones so probe chains stay intact. Insertion
+// reuses them, and removal clears the tombstones that end a probe chain, so misses stay short under instance and device churn.
+// When live entries and tombstones fill three quarters of the array, the live entries are copied into a new array, twice as large
+// if they alone need it, which is then published. Replaced arrays are kept until the table is destroyed because a reader may still
+// be probing them.
+template <typename DATA_T, size_t kInitialCapacity = 512>
+class layer_data_table {
+    static_assert((kInitialCapacity & (kInitialCapacity - 1)) == 0, "layer_data_table capacity must be a power of two");
+
+   public:
+    layer_data_table() {
+        arrays_.emplace_back(new slot_array(kInitialCapacity));
+        array_.store(arrays_.back().get(), std::memory_order_release);
+    }
+
+    // Returns the data stored for data_key, or nullptr if there is none
+    DATA_T *find(void *data_key) const {
+        // One-entry cache of the last lookup on this thread. A freed dispatch key can be reused by a later instance or device,
+        // so any removal from the table bumps the generation and invalidates every cached entry.
+        struct cached_lookup {
+            const layer_data_table *table;
+            void *key;
+            DATA_T *data;
+            uint64_t generation;
+        };
+        static thread_local cached_lookup cache = {};
+        const uint64_t generation = generation_.load(std::memory_order_acquire);
+        if (cache.key == data_key && cache.table == this && cache.generation == generation) return cache.data;
+
+        DATA_T *data = probe(*array_.load(std::memory_order_acquire), data_key);
+        if (data) cache = {this, data_key, data, generation};
+        return data;
+    }
+
+    // Stores data for data_key unless the key is already present. Returns the data now stored for the key.
+    DATA_T *insert(void *data_key, DATA_T *data) {
+        std::lock_guard<std::mutex> lock(write_mutex_);
+        slot_array *array = array_.load(std::memory_order_relaxed);
+        slot_t *slot = find_slot(*array, data_key);
+        if (slot) return slot->data.load(std::memory_order_relaxed);
+        if ((used_ + 1) * 4 > array->capacity() * 3) array = rebuild();
+
+        slot = insert_slot(*array, data_key);
+        if (slot->key.load(std::memory_order_relaxed) == nullptr) used_++;
+        live_++;
+        slot->data.store(data, std::memory_order_relaxed);
+        slot->key.store(data_key, std::memory_order_release);
+        return data;
+    }
+
+    // Removes data_key from the table, returning the data that was stored for it
+    DATA_T *erase(void *data_key) {
+        std::lock_guard<std::mutex> lock(write_mutex_);
+        slot_array &array = *array_.load(std::memory_order_relaxed);
+        slot_t *slot = find_slot(array, data_key);
+        if (!slot) return nullptr;
+        DATA_T *data = slot->data.load(std::memory_order_relaxed);
+        slot->data.store(nullptr, std::memory_order_release);
+        slot->key.store(tombstone(), std::memory_order_release);
+        live_--;
+        generation_.fetch_add(1, std::memory_order_acq_rel);
+
+        // No probe chain runs through tombstones that are followed by an empty slot, so they can be emptied. A reader that sees
+        // either value stops at the same place.
+        size_t index = static_cast<size_t>(slot - array.slots.get());
+        if (array.slots[(index + 1) & array.mask].key.load(std::memory_order_relaxed) == nullptr) {
+            while (array.slots[index].key.load(std::memory_order_relaxed) == tombstone()) {
+                array.slots[index].key.store(nullptr, std::memory_order_release);
+                used_--;
+                index = (index - 1) & array.mask;
+            }
+        }
+        return data;
+    }
+
+    // Copy of all stored data, for the rare paths that need to visit every instance or device
+    std::vector<DATA_T *> snapshot() const {
+        std::lock_guard<std::mutex> lock(write_mutex_);
+        const slot_array &array = *array_.load(std::memory_order_relaxed);
+        std::vector<DATA_T *> result;
+        for (size_t i = 0; i < array.capacity(); ++i) {
+            DATA_T *data = array.slots[i].data.load(std::memory_order_relaxed);
+            if (data) result.push_back(data);
+        }
+        return result;
+    }
+
+   private:
+    struct slot_t {
+        std::atomic<void *> key{nullptr};
+        std::atomic<DATA_T *> data{nullptr};
+    };
+    struct slot_array {
+        explicit slot_array(size_t capacity) : mask(capacity - 1), slots(new slot_t[capacity]) {}
+        size_t capacity() const { return mask + 1; }
+        const size_t mask;
+        std::unique_ptr<slot_t[]> slots;
+    };
+
+    static void *tombstone() { return reinterpret_cast<void *>(uintptr_t(1)); }
+    static size_t hash(void *data_key, size_t mask) {
+        // Dispatch keys are pointers to loader dispatch tables, so drop the alignment bits before mixing
+        return static_cast<size_t>(((reinterpret_cast<uintptr_t>(data_key) >> 4) * 0x9E3779B97F4A7C15ull) >> 32) & mask;
+    }
+
+    static slot_t *find_slot(slot_array &array, void *data_key) {
+        for (size_t i = 0, index = hash(data_key, array.mask); i <= array.mask; ++i, index = (index + 1) & array.mask) {
+            void *key = array.slots[index].key.load(std::memory_order_relaxed);
+            if (key == data_key) return &array.slots[index];
+            if (key == nullptr) break;
+        }
+        return nullptr;
+    }
+
+    // First tombstone or empty slot on the probe chain of a key that is not in the array. The load limit keeps one empty.
+    static slot_t *insert_slot(slot_array &array, void *data_key) {
+        size_t index = hash(data_key, array.mask);
+        while (true) {
+            void *key = array.slots[index].key.load(std::memory_order_relaxed);
+            if (key == nullptr || key == tombstone()) return &array.slots[index];
+            index = (index + 1) & array.mask;
+        }
+    }
+
+    static DATA_T *probe(const slot_array &array, void *data_key) {
+        for (size_t i = 0, index = hash(data_key, array.mask); i <= array.mask; ++i, index = (index + 1) & array.mask) {
+            const slot_t &slot = array.slots[index];
+            void *key = slot.key.load(std::memory_order_acquire);
+            if (key == data_key) {
+                DATA_T *data = slot.data.load(std::memory_order_acquire);
+                // The slot may have been removed and reused between the two loads; only trust data read while the key held
+                if (slot.key.load(std::memory_order_acquire) == data_key) return data;
+                return probe(array, data_key);
+            }
+            if (key == nullptr) break;
+        }
+        return nullptr;
+    }
+
+    // Copies the live entries into a new array without tombstones, with room for at least as many again, and publishes it
+    slot_array *rebuild() {
+        const slot_array &old_array = *array_.load(std::memory_order_relaxed);
+        size_t capacity = old_array.capacity();
+        while ((live_ + 1) * 2 > capacity) capacity *= 2;
+        arrays_.emplace_back(new slot_array(capacity));
+        slot_array *array = arrays_.back().get();
+        for (size_t i = 0; i < old_array.capacity(); ++i) {
+            void *key = old_array.slots[i].key.load(std::memory_order_relaxed);
+            if (key == nullptr || key == tombstone()) continue;
+            slot_t *slot = insert_slot(*array, key);
+            slot->data.store(old_array.slots[i].data.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            slot->key.store(key, std::memory_order_relaxed);
+        }
+        used_ = live_;
+        array_.store(array, std::memory_order_release);
+        return array;
+    }
+
+    std::atomic<slot_array *> array_{nullptr};
+    std::vector<std::unique_ptr<slot_array>> arrays_;
+    size_t live_ = 0;
+    size_t used_ = 0;
+    std::atomic<uint64_t> generation_{0};
+    mutable std::mutex write_mutex_;
+};
+
+// For the given data key, look up the layer_data instance from given layer_data_table, creating it if it does not exist
+template <typename DATA_T, size_t kInitialCapacity>
+DATA_T *GetLayerDataPtr(void *data_key, layer_data_table<DATA_T, kInitialCapacity> &layer_data_map) {
+    DATA_T *debug_data = layer_data_map.find(data_key);
+    if (debug_data == nullptr) {
+        std::unique_ptr<DATA_T> new_data(new DATA_T);
+        debug_data = layer_data_map.insert(data_key, new_data.get());
+        if (debug_data == new_data.get()) new_data.release();
+    }
+    return debug_data;
+}
+
+template <typename DATA_T, size_t kInitialCapacity>
+void FreeLayerDataPtr(void *data_key, layer_data_table<DATA_T, kInitialCapacity> &layer_data_map) {
+    DATA_T *debug_data = layer_data_map.erase(data_key);
+    assert(debug_data);
+    delete debug_data;
+}
+
 #endif  // LAYER_DATA_H
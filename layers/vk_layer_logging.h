@@ -32,10 +32,14 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <memory>
 #include <mutex>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 #include <unordered_map>
 #include <utility>
@@ -136,6 +140,390 @@ struct LoggingLabelState {
     }
 };
 
+// Index of a VUID in the generated vuid_spec_text table, or -1 if it is not a spec VUID. The table is generated in sorted order.
+static inline int32_t GetVuidIndex(const char *vuid) {
+    const vuid_spec_text_pair *begin = std::begin(vuid_spec_text);
+    const vuid_spec_text_pair *end = std::end(vuid_spec_text);
+    const vuid_spec_text_pair *entry =
+        std::lower_bound(begin, end, vuid, [](const vuid_spec_text_pair &pair, const char *key) { return strcmp(pair.vuid, key) < 0; });
+    if (entry == end || strcmp(entry->vuid, vuid) != 0) return -1;
+    return static_cast<int32_t>(entry - begin);
+}
+
+// GetVuidIndex() memoized on the address of the VUID string. Most VUIDs are string literals, so a message that fires repeatedly
+// hits the same entry. A hit is confirmed against the table, so an address reused for a different string cannot return a stale
+// index.
+static inline int32_t GetVuidIndexCached(const char *vuid) {
+    struct VuidIndexCacheEntry {
+        const char *vuid;
+        int32_t index;
+    };
+    static const size_t kVuidIndexCacheSize = 64;
+    static thread_local VuidIndexCacheEntry vuid_index_cache[kVuidIndexCacheSize] = {};
+    VuidIndexCacheEntry &entry = vuid_index_cache[(reinterpret_cast<uintptr_t>(vuid) >> 3) % kVuidIndexCacheSize];
+    if (entry.vuid == vuid && strcmp(vuid_spec_text[entry.index].vuid, vuid) == 0) return entry.index;
+    int32_t index = GetVuidIndex(vuid);
+    if (index >= 0) {
+        entry.vuid = vuid;
+        entry.index = index;
+    }
+    return index;
+}
+
+// Writes preformatted log records to a file on a background thread, so that threads reporting messages never wait on file I/O.
+// Records pass through a bounded multi-producer ring buffer without locking. When the ring is full, producers wait for the
+// writer rather than drop messages. The destructor writes out every record already queued.
+class AsyncLogSink {
+   public:
+    explicit AsyncLogSink(FILE *output) : output_(output), slots_(new Slot[kSlotCount]) {
+        for (uint64_t i = 0; i < kSlotCount; ++i) slots_[i].sequence.store(i, std::memory_order_relaxed);
+        writer_ = std::thread(&AsyncLogSink::WriterLoop, this);
+    }
+
+    ~AsyncLogSink() {
+        stop_.store(true);
+        Wake();
+        writer_.join();
+    }
+
+    void Write(std::string record) {
+        uint64_t position = enqueue_position_.load(std::memory_order_relaxed);
+        while (true) {
+            Slot &slot = slots_[position % kSlotCount];
+            const int64_t lag = static_cast<int64_t>(slot.sequence.load(std::memory_order_acquire) - position);
+            if (lag == 0) {
+                if (enqueue_position_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    slot.record = std::move(record);
+                    // Sequentially consistent with the check of writer_sleeping_ below, so that either the writer sees this
+                    // record before it sleeps or this thread sees it sleeping
+                    slot.sequence.store(position + 1);
+                    break;
+                }
+            } else if (lag < 0) {
+                // The ring is full until the writer catches up
+                Wake();
+                std::this_thread::yield();
+                position = enqueue_position_.load(std::memory_order_relaxed);
+            } else {
+                position = enqueue_position_.load(std::memory_order_relaxed);
+            }
+        }
+        if (writer_sleeping_.load()) Wake();
+    }
+
+   private:
+    static const uint64_t kSlotCount = 4096;
+    static const size_t kMaxBatchSize = 64 * 1024;
+
+    struct Slot {
+        std::atomic<uint64_t> sequence{0};
+        std::string record;
+    };
+
+    void Wake() {
+        { std::lock_guard<std::mutex> lock(wake_lock_); }
+        wake_.notify_one();
+    }
+
+    bool RecordReady(uint64_t position, std::memory_order order = std::memory_order_acquire) const {
+        return slots_[position % kSlotCount].sequence.load(order) == position + 1;
+    }
+
+    void WriterLoop() {
+        std::string batch;
+        uint64_t position = 0;
+        while (true) {
+            batch.clear();
+            while (batch.size() < kMaxBatchSize && RecordReady(position)) {
+                Slot &slot = slots_[position % kSlotCount];
+                batch += slot.record;
+                slot.record.clear();
+                slot.sequence.store(position + kSlotCount, std::memory_order_release);
+                ++position;
+            }
+            if (!batch.empty()) {
+                fwrite(batch.data(), 1, batch.size(), output_);
+                fflush(output_);
+                continue;
+            }
+            if (stop_.load()) return;
+            std::unique_lock<std::mutex> lock(wake_lock_);
+            writer_sleeping_.store(true);
+            if (!RecordReady(position, std::memory_order_seq_cst) && !stop_.load()) {
+                wake_.wait_for(lock, std::chrono::milliseconds(100));
+            }
+            writer_sleeping_.store(false, std::memory_order_relaxed);
+        }
+    }
+
+    FILE *output_;
+    std::unique_ptr<Slot[]> slots_;
+    std::atomic<uint64_t> enqueue_position_{0};
+    std::atomic<bool> writer_sleeping_{false};
+    std::atomic<bool> stop_{false};
+    std::mutex wake_lock_;
+    std::condition_variable wake_;
+    std::thread writer_;
+};
+
+// Record formats for log_filename output. Text is the human-readable default; the others write one record per message, with
+// the fields kept apart, for tools to ingest.
+enum LogFormat {
+    kLogFormatText,
+    kLogFormatJsonLines,  // One JSON object per line
+    kLogFormatBinary,     // Length-prefixed records after a file header, see BinaryLogHeader()
+};
+
+// Where messenger_structured_log_callback writes its records
+struct StructuredLogOutput {
+    LogFormat format;
+    FILE *output;
+    AsyncLogSink *async_sink;  // Null to write records synchronously
+};
+
+// Counts validation messages per VUID and object, so that repeats past the duplicate_message_limit setting are dropped before
+// they are formatted. Counting takes no locks. Slots are found by a hash of the VUID and object, then matched on both, so that
+// messages whose hashes collide are counted apart. The table has a fixed size; once it is full, new messages are not limited.
+class DuplicateMessageCounter {
+   public:
+    // A message dropped one or more times since the last call to TakeSuppressed()
+    struct Suppressed {
+        std::string vuid;
+        VkFlags msg_flags;
+        VkDebugReportObjectTypeEXT object_type;
+        uint64_t object;
+        uint64_t count;
+    };
+
+    explicit DuplicateMessageCounter(uint32_t limit) : limit_(limit), slots_(new Slot[kSlotCount]) {}
+    ~DuplicateMessageCounter() {
+        for (size_t i = 0; i < kSlotCount; ++i) delete[] slots_[i].vuid.load();
+    }
+
+    uint32_t Limit() const { return limit_; }
+
+    // Count one occurrence of a message, returning false if it has already been reported limit times
+    bool Count(const char *vuid, VkFlags msg_flags, VkDebugReportObjectTypeEXT object_type, uint64_t object) {
+        const uint64_t key = Key(vuid, object);
+        for (size_t probe = 0; probe < kMaxProbes; ++probe) {
+            Slot &slot = slots_[(key + probe) % kSlotCount];
+            uint64_t slot_key = slot.key.load(std::memory_order_acquire);
+            if (slot_key == 0) {
+                if (slot.key.compare_exchange_strong(slot_key, key, std::memory_order_acq_rel)) {
+                    // First occurrence: keep what the summary needs to describe it
+                    const size_t vuid_size = strlen(vuid) + 1;
+                    char *vuid_copy = new char[vuid_size];
+                    memcpy(vuid_copy, vuid, vuid_size);
+                    slot.msg_flags = msg_flags;
+                    slot.object_type = object_type;
+                    slot.object = object;
+                    slot.vuid.store(vuid_copy, std::memory_order_release);
+                    slot_key = key;
+                }
+            }
+            if (slot_key != key || !Matches(slot, vuid, object)) continue;
+            if (slot.count.fetch_add(1, std::memory_order_relaxed) < limit_) return true;
+            pending_summary_.store(true, std::memory_order_relaxed);
+            return false;
+        }
+        return true;
+    }
+
+    // Collect the messages dropped since the last call
+    std::vector<Suppressed> TakeSuppressed() {
+        std::vector<Suppressed> suppressed;
+        if (!pending_summary_.exchange(false, std::memory_order_relaxed)) return suppressed;
+        std::lock_guard<std::mutex> lock(summary_lock_);
+        for (size_t i = 0; i < kSlotCount; ++i) {
+            Slot &slot = slots_[i];
+            const char *vuid = slot.vuid.load(std::memory_order_acquire);
+            if (!vuid) continue;
+            uint64_t count = slot.count.load(std::memory_order_relaxed);
+            uint64_t reported = std::max<uint64_t>(slot.summarized, limit_);
+            if (count <= reported) continue;
+            suppressed.push_back({vuid, slot.msg_flags, slot.object_type, slot.object, count - reported});
+            slot.summarized = count;
+        }
+        return suppressed;
+    }
+
+   private:
+    static const size_t kSlotCount = 4096;
+    static const size_t kMaxProbes = 32;
+
+    struct Slot {
+        std::atomic<uint64_t> key{0};
+        std::atomic<uint64_t> count{0};
+        std::atomic<const char *> vuid{nullptr};
+        VkFlags msg_flags = 0;
+        VkDebugReportObjectTypeEXT object_type = VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT;
+        uint64_t object = 0;
+        uint64_t summarized = 0;  // Guarded by summary_lock_
+    };
+
+    // Whether a slot with the same key holds this VUID and object. The thread that claimed the slot publishes them right after
+    // claiming it, so wait for that first.
+    static bool Matches(const Slot &slot, const char *vuid, uint64_t object) {
+        const char *slot_vuid;
+        while (!(slot_vuid = slot.vuid.load(std::memory_order_acquire))) std::this_thread::yield();
+        return slot.object == object && strcmp(slot_vuid, vuid) == 0;
+    }
+
+    // FNV-1a over the VUID string, mixed with the object handle. Zero marks an empty slot.
+    static uint64_t Key(const char *vuid, uint64_t object) {
+        uint64_t hash = 14695981039346656037ULL;
+        for (const char *c = vuid; *c; ++c) {
+            hash = (hash ^ static_cast<uint8_t>(*c)) * 1099511628211ULL;
+        }
+        hash ^= object + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2);
+        return hash ? hash : 1;
+    }
+
+    uint32_t limit_;
+    std::unique_ptr<Slot[]> slots_;
+    std::atomic<bool> pending_summary_{false};
+    std::mutex summary_lock_;
+};
+
+// Names given to objects through vkSetDebugUtilsObjectNameEXT or vkDebugMarkerSetObjectNameEXT. The table is split into shards
+// by handle, each with its own lock and open-addressed entries, so that threads naming and looking up different objects rarely
+// wait on each other, and neither waits on debug_report_mutex. Names shorter than kInlineNameSize are stored in the entry
+// itself, so naming an object does not allocate unless a shard has to grow.
+class ObjectNameMap {
+   public:
+    static const size_t kInlineNameSize = 40;
+
+    // Set the name of an object, or remove it if name is null
+    void Set(uint64_t handle, const char *name) {
+        const uint64_t hash = Hash(handle);
+        Shard &shard = shards_[hash % kShardCount];
+        std::lock_guard<std::mutex> lock(shard.lock);
+        if (!name) {
+            Entry *entry = shard.Find(handle, hash / kShardCount);
+            if (!entry) return;
+            entry->state = kTombstone;
+            entry->long_name.reset();
+            --shard.used;
+            ++shard.tombstones;
+            named_count_.fetch_sub(1, std::memory_order_relaxed);
+            return;
+        }
+        if ((shard.used + shard.tombstones + 1) * 4 > shard.entries.size() * 3) shard.Rehash();
+        Entry *entry = shard.Find(handle, hash / kShardCount);
+        if (!entry) {
+            entry = shard.Insert(handle, hash / kShardCount);
+            named_count_.fetch_add(1, std::memory_order_relaxed);
+        }
+        entry->SetName(name);
+    }
+
+    // Append the name of an object to output, returning false if the object has no name or an empty one
+    bool Append(uint64_t handle, std::string *output) const {
+        if (named_count_.load(std::memory_order_relaxed) == 0) return false;
+        const uint64_t hash = Hash(handle);
+        const Shard &shard = shards_[hash % kShardCount];
+        std::lock_guard<std::mutex> lock(shard.lock);
+        const Entry *entry = shard.Find(handle, hash / kShardCount);
+        if (!entry || entry->length == 0) return false;
+        output->append(entry->Name(), entry->length);
+        return true;
+    }
+
+    std::string Get(uint64_t handle) const {
+        std::string name;
+        Append(handle, &name);
+        return name;
+    }
+
+   private:
+    static const size_t kShardCount = 16;
+    static const size_t kInitialEntryCount = 16;
+    enum EntryState : uint32_t { kEmpty = 0, kUsed, kTombstone };
+
+    struct Entry {
+        uint64_t handle = 0;
+        EntryState state = kEmpty;
+        uint32_t length = 0;
+        char inline_name[kInlineNameSize];
+        std::unique_ptr<char[]> long_name;
+
+        const char *Name() const { return long_name ? long_name.get() : inline_name; }
+
+        void SetName(const char *name) {
+            const size_t name_length = strlen(name);
+            if (name_length < kInlineNameSize) {
+                long_name.reset();
+                memcpy(inline_name, name, name_length + 1);
+            } else {
+                long_name.reset(new char[name_length + 1]);
+                memcpy(long_name.get(), name, name_length + 1);
+            }
+            length = static_cast<uint32_t>(name_length);
+        }
+    };
+
+    struct Shard {
+        mutable std::mutex lock;
+        std::vector<Entry> entries;  // Power of two sized, linear probing
+        size_t used = 0;
+        size_t tombstones = 0;
+
+        Entry *Find(uint64_t handle, uint64_t hash) {
+            return const_cast<Entry *>(static_cast<const Shard *>(this)->Find(handle, hash));
+        }
+
+        const Entry *Find(uint64_t handle, uint64_t hash) const {
+            if (entries.empty()) return nullptr;
+            const size_t mask = entries.size() - 1;
+            for (size_t index = hash & mask;; index = (index + 1) & mask) {
+                const Entry &entry = entries[index];
+                if (entry.state == kEmpty) return nullptr;
+                if (entry.state == kUsed && entry.handle == handle) return &entry;
+            }
+        }
+
+        // The caller has checked that the handle is not present and that there is room for it
+        Entry *Insert(uint64_t handle, uint64_t hash) {
+            const size_t mask = entries.size() - 1;
+            size_t index = hash & mask;
+            while (entries[index].state == kUsed) index = (index + 1) & mask;
+            Entry &entry = entries[index];
+            if (entry.state == kTombstone) --tombstones;
+            entry.handle = handle;
+            entry.state = kUsed;
+            ++used;
+            return &entry;
+        }
+
+        // Drop tombstones, doubling the size if the shard is at least half full
+        void Rehash() {
+            size_t entry_count = entries.size();
+            if (entry_count == 0) {
+                entry_count = kInitialEntryCount;
+            } else if ((used + 1) * 2 > entry_count) {
+                entry_count *= 2;
+            }
+            std::vector<Entry> old_entries(entry_count);
+            old_entries.swap(entries);
+            used = 0;
+            tombstones = 0;
+            for (auto &old_entry : old_entries) {
+                if (old_entry.state != kUsed) continue;
+                Entry *entry = Insert(old_entry.handle, Hash(old_entry.handle) / kShardCount);
+                entry->length = old_entry.length;
+                entry->long_name = std::move(old_entry.long_name);
+                if (!entry->long_name) memcpy(entry->inline_name, old_entry.inline_name, old_entry.length + 1);
+            }
+        }
+    };
+
+    // Handles are often pointers or small indices; spread them over the shards and entries
+    static uint64_t Hash(uint64_t handle) { return (handle * 0x9e3779b97f4a7c15ULL) >> 16; }
+
+    Shard shards_[kShardCount];
+    std::atomic<size_t> named_count_{0};
+};
+
 typedef struct _debug_report_data {
     VkLayerDbgFunctionNode *debug_callback_list{nullptr};
     VkLayerDbgFunctionNode *default_debug_callback_list{nullptr};
@@ -145,50 +533,59 @@ typedef struct _debug_report_data {
     bool g_DEBUG_UTILS{false};
     bool queueLabelHasInsert{false};
     bool cmdBufLabelHasInsert{false};
-    std::unordered_map<uint64_t, std::string> debugObjectNameMap;
-    std::unordered_map<uint64_t, std::string> debugUtilsObjectNameMap;
+    ObjectNameMap debugObjectNameMap;
+    ObjectNameMap debugUtilsObjectNameMap;
     std::unordered_map<VkQueue, std::unique_ptr<LoggingLabelState>> debugUtilsQueueLabels;
     std::unordered_map<VkCommandBuffer, std::unique_ptr<LoggingLabelState>> debugUtilsCmdBufLabels;
     // This mutex is defined as mutable since the normal usage for a debug report object is as 'const'. The mutable keyword allows
     // the layers to continue this pattern, but also allows them to use/change this specific member for synchronization purposes.
     mutable std::mutex debug_report_mutex;
-
-    void DebugReportSetUtilsObjectName(const VkDebugUtilsObjectNameInfoEXT *pNameInfo) {
-        std::unique_lock<std::mutex> lock(debug_report_mutex);
-        if (pNameInfo->pObjectName) {
-            debugUtilsObjectNameMap[pNameInfo->objectHandle] = pNameInfo->pObjectName;
-        } else {
-            debugUtilsObjectNameMap.erase(pNameInfo->objectHandle);
+    // Message IDs muted through the message_id_filter setting: a bit per spec VUID, indexed as by GetVuidIndex(), and a list of
+    // the other (UNASSIGNED and implicit) IDs. Set up at instance creation and read without taking debug_report_mutex.
+    std::vector<uint64_t> filtered_vuid_bits;
+    std::vector<std::string> filtered_message_ids;
+    // Repeat counts for the duplicate_message_limit setting, or null when repeated messages are not limited. Set up at instance
+    // creation.
+    std::unique_ptr<DuplicateMessageCounter> duplicate_messages;
+    // Background writers for log_filename output when the log_async setting is enabled
+    std::vector<std::unique_ptr<AsyncLogSink>> async_log_sinks;
+    // Targets of the log_format setting's structured callbacks
+    std::vector<std::unique_ptr<StructuredLogOutput>> structured_log_outputs;
+
+    void FilterMessageId(const std::string &message_id) {
+        int32_t index = GetVuidIndex(message_id.c_str());
+        if (index < 0) {
+            filtered_message_ids.push_back(message_id);
+            return;
         }
+        if (filtered_vuid_bits.empty()) filtered_vuid_bits.resize((sizeof(vuid_spec_text) / sizeof(vuid_spec_text_pair) + 63) / 64);
+        filtered_vuid_bits[index / 64] |= uint64_t(1) << (index % 64);
     }
 
-    void DebugReportSetMarkerObjectName(const VkDebugMarkerObjectNameInfoEXT *pNameInfo) {
-        std::unique_lock<std::mutex> lock(debug_report_mutex);
-        if (pNameInfo->pObjectName) {
-            debugObjectNameMap[pNameInfo->object] = pNameInfo->pObjectName;
-        } else {
-            debugObjectNameMap.erase(pNameInfo->object);
+    bool IsMessageIdFiltered(const char *message_id) const {
+        if (!message_id || (filtered_vuid_bits.empty() && filtered_message_ids.empty())) return false;
+        if (!filtered_vuid_bits.empty()) {
+            int32_t index = GetVuidIndexCached(message_id);
+            if (index >= 0) return (filtered_vuid_bits[index / 64] >> (index % 64)) & 1;
         }
+        for (const auto &filtered_id : filtered_message_ids) {
+            if (filtered_id == message_id) return true;
+        }
+        return false;
     }
 
-    std::string DebugReportGetUtilsObjectName(const uint64_t object) const {
-        std::string label = "";
-        const auto utils_name_iter = debugUtilsObjectNameMap.find(object);
-        if (utils_name_iter != debugUtilsObjectNameMap.end()) {
-            label = utils_name_iter->second;
-        }
-        return label;
+    void DebugReportSetUtilsObjectName(const VkDebugUtilsObjectNameInfoEXT *pNameInfo) {
+        debugUtilsObjectNameMap.Set(pNameInfo->objectHandle, pNameInfo->pObjectName);
     }
 
-    std::string DebugReportGetMarkerObjectName(const uint64_t object) const {
-        std::string label = "";
-        const auto marker_name_iter = debugObjectNameMap.find(object);
-        if (marker_name_iter != debugObjectNameMap.end()) {
-            label = marker_name_iter->second;
-        }
-        return label;
+    void DebugReportSetMarkerObjectName(const VkDebugMarkerObjectNameInfoEXT *pNameInfo) {
+        debugObjectNameMap.Set(pNameInfo->object, pNameInfo->pObjectName);
     }
 
+    std::string DebugReportGetUtilsObjectName(const uint64_t object) const { return debugUtilsObjectNameMap.Get(object); }
+
+    std::string DebugReportGetMarkerObjectName(const uint64_t object) const { return debugObjectNameMap.Get(object); }
+
     template <typename HANDLE_T>
     std::string FormatHandle(HANDLE_T *h) const {
         return FormatHandle(HandleToUint64(h));
@@ -199,14 +596,12 @@ typedef struct _debug_report_data {
         sprintf(uint64_string, "0x%" PRIxLEAST64, h);
         std::string ret = uint64_string;
 
-        std::string name = DebugReportGetUtilsObjectName(h);
-        if (name.empty()) {
-            name = DebugReportGetMarkerObjectName(h);
-        }
-        if (!name.empty()) {
-            ret.append("[");
-            ret.append(name);
+        const size_t handle_length = ret.size();
+        ret.append("[");
+        if (debugUtilsObjectNameMap.Append(h, &ret) || debugObjectNameMap.Append(h, &ret)) {
             ret.append("]");
+        } else {
+            ret.resize(handle_length);
         }
         return ret;
     }
@@ -390,6 +785,7 @@ static inline void RemoveAllMessageCallbacks(debug_report_data *debug_data, VkLa
 static inline bool debug_log_msg(const debug_report_data *debug_data, VkFlags msg_flags, VkDebugReportObjectTypeEXT object_type,
                                  uint64_t src_object, size_t location, const char *layer_prefix, const char *message,
                                  const char *text_vuid) {
+    if (debug_data->IsMessageIdFiltered(text_vuid)) return false;
     bool bail = false;
     VkLayerDbgFunctionNode *layer_dbg_node = NULL;
 
@@ -919,6 +1315,22 @@ static inline bool will_log_msg(debug_report_data *debug_data, VkFlags msg_flags
 
     return true;
 }
+
+// The checks of vlog_msg that do not depend on the message text: severity and type enablement, and the message ID filter.
+// Done without taking debug_report_mutex, so that a filtered message costs a few loads and compares.
+static inline bool will_log_msg(const debug_report_data *debug_data, VkFlags msg_flags, const char *vuid_text) {
+    if (!debug_data) return false;
+    VkFlags local_severity = 0;
+    VkFlags local_type = 0;
+    DebugReportFlagsToAnnotFlags(msg_flags, true, &local_severity, &local_type);
+    if (!(debug_data->active_severities & local_severity) || !(debug_data->active_types & local_type)) return false;
+    return !debug_data->IsMessageIdFiltered(vuid_text);
+}
+
+static inline bool will_log_msg(const debug_report_data *debug_data, VkFlags msg_flags, const std::string &vuid_text) {
+    return will_log_msg(debug_data, msg_flags, vuid_text.c_str());
+}
+
 #ifndef WIN32
 static inline int string_sprintf(std::string *output, const char *fmt, ...) __attribute__((format(printf, 2, 3)));
 #endif
@@ -955,14 +1367,11 @@ static inline int vasprintf(char **strp, char const *fmt, va_list ap) {
 
 // Output log message via DEBUG_REPORT. Takes format and variable arg list so that output string is only computed if a message
 // needs to be logged
-#ifndef WIN32
-static inline bool log_msg(const debug_report_data *debug_data, VkFlags msg_flags, VkDebugReportObjectTypeEXT object_type,
-                           uint64_t src_object, std::string vuid_text, const char *format, ...)
-    __attribute__((format(printf, 6, 7)));
-#endif
-static inline bool log_msg(const debug_report_data *debug_data, VkFlags msg_flags, VkDebugReportObjectTypeEXT object_type,
-                           uint64_t src_object, std::string vuid_text, const char *format, ...) {
+static inline bool vlog_msg(const debug_report_data *debug_data, VkFlags msg_flags, VkDebugReportObjectTypeEXT object_type,
+                            uint64_t src_object, const char *vuid_text, const char *format, va_list argptr) {
     if (!debug_data) return false;
+    // Muted messages are dropped before any locking or formatting
+    if (debug_data->IsMessageIdFiltered(vuid_text)) return false;
     std::unique_lock<std::mutex> lock(debug_data->debug_report_mutex);
     VkFlags local_severity = 0;
     VkFlags local_type = 0;
@@ -971,59 +1380,108 @@ static inline bool log_msg(const debug_report_data *debug_data, VkFlags msg_flag
         // Message is not wanted
         return false;
     }
+    if (debug_data->duplicate_messages &&
+        !debug_data->duplicate_messages->Count(vuid_text, msg_flags, object_type, src_object)) {
+        return false;
+    }
 
-    va_list argptr;
-    va_start(argptr, format);
     char *str;
     if (-1 == vasprintf(&str, format, argptr)) {
         // On failure, glibc vasprintf leaves str undefined
         str = nullptr;
     }
-    va_end(argptr);
 
     std::string str_plus_spec_text(str ? str : "Allocation failure");
 
     // Append the spec error text to the error message, unless it's an UNASSIGNED or UNDEFINED vuid
-    if ((vuid_text.find("UNASSIGNED-") == std::string::npos) && (vuid_text.find(kVUIDUndefined) == std::string::npos)) {
-        // Linear search makes no assumptions about the layout of the string table
-        // This is not fast, but it does not need to be at this point in the error reporting path
-        uint32_t num_vuids = sizeof(vuid_spec_text) / sizeof(vuid_spec_text_pair);
-        const char *spec_text = nullptr;
-        for (uint32_t i = 0; i < num_vuids; i++) {
-            if (0 == strcmp(vuid_text.c_str(), vuid_spec_text[i].vuid)) {
-                spec_text = vuid_spec_text[i].spec_text;
-                break;
-            }
-        }
-
-        if (nullptr == spec_text) {
+    if (!strstr(vuid_text, "UNASSIGNED-") && !strstr(vuid_text, kVUIDUndefined)) {
+        int32_t vuid_index = GetVuidIndexCached(vuid_text);
+        if (vuid_index < 0) {
             // If this happens, you've hit a VUID string that isn't defined in the spec's json file
             // Try running 'vk_validation_stats -c' to look for invalid VUID strings in the repo code
             assert(0);
         } else {
             str_plus_spec_text += " The Vulkan spec states: ";
-            str_plus_spec_text += spec_text;
+            str_plus_spec_text += vuid_spec_text[vuid_index].spec_text;
         }
     }
 
     // Append layer prefix with VUID string, pass in recovered legacy numerical VUID
     bool result = debug_log_msg(debug_data, msg_flags, object_type, src_object, 0, "Validation", str_plus_spec_text.c_str(),
-                                vuid_text.c_str());
+                                vuid_text);
 
     free(str);
     return result;
 }
 
-static inline VKAPI_ATTR VkBool32 VKAPI_CALL report_log_callback(VkFlags msg_flags, VkDebugReportObjectTypeEXT obj_type,
-                                                                 uint64_t src_object, size_t location, int32_t msg_code,
-                                                                 const char *layer_prefix, const char *message, void *user_data) {
+#ifndef WIN32
+static inline bool log_msg(const debug_report_data *debug_data, VkFlags msg_flags, VkDebugReportObjectTypeEXT object_type,
+                           uint64_t src_object, const char *vuid_text, const char *format, ...)
+    __attribute__((format(printf, 6, 7)));
+static inline bool log_msg(const debug_report_data *debug_data, VkFlags msg_flags, VkDebugReportObjectTypeEXT object_type,
+                           uint64_t src_object, const std::string &vuid_text, const char *format, ...)
+    __attribute__((format(printf, 6, 7)));
+#endif
+static inline bool log_msg(const debug_report_data *debug_data, VkFlags msg_flags, VkDebugReportObjectTypeEXT object_type,
+                           uint64_t src_object, const char *vuid_text, const char *format, ...) {
+    va_list argptr;
+    va_start(argptr, format);
+    bool result = vlog_msg(debug_data, msg_flags, object_type, src_object, vuid_text, format, argptr);
+    va_end(argptr);
+    return result;
+}
+
+static inline bool log_msg(const debug_report_data *debug_data, VkFlags msg_flags, VkDebugReportObjectTypeEXT object_type,
+                           uint64_t src_object, const std::string &vuid_text, const char *format, ...) {
+    va_list argptr;
+    va_start(argptr, format);
+    bool result = vlog_msg(debug_data, msg_flags, object_type, src_object, vuid_text.c_str(), format, argptr);
+    va_end(argptr);
+    return result;
+}
+
+static inline const char *LogMsgVuid(const char *vuid_text) { return vuid_text; }
+static inline const char *LogMsgVuid(const std::string &vuid_text) { return vuid_text.c_str(); }
+
+// Same arguments and result as log_msg, but the format arguments -- FormatHandle() calls and other strings built for the
+// message -- are only evaluated if will_log_msg() passes. Every argument is evaluated at most once: the first five are bound to
+// the parameters of a lambda, which the format arguments are evaluated in.
+#define LOG_MSG(debug_data, msg_flags, object_type, src_object, vuid_text, ...)                                                   \
+    [&](const debug_report_data *log_msg_data, VkFlags log_msg_flags, VkDebugReportObjectTypeEXT log_msg_object_type,            \
+        uint64_t log_msg_object, const char *log_msg_vuid) {                                                                      \
+        return will_log_msg(log_msg_data, log_msg_flags, log_msg_vuid) &&                                                         \
+               log_msg(log_msg_data, log_msg_flags, log_msg_object_type, log_msg_object, log_msg_vuid, __VA_ARGS__);              \
+    }((debug_data), (msg_flags), (object_type), (src_object), LogMsgVuid(vuid_text))
+
+// Report how many times each message over the duplicate_message_limit setting was dropped since the previous summary
+static inline void ReportSuppressedMessages(const debug_report_data *debug_data) {
+    if (!debug_data || !debug_data->duplicate_messages) return;
+    auto suppressed = debug_data->duplicate_messages->TakeSuppressed();
+    if (suppressed.empty()) return;
+    std::unique_lock<std::mutex> lock(debug_data->debug_report_mutex);
+    for (const auto &message : suppressed) {
+        std::string summary;
+        string_sprintf(&summary, "Suppressed %" PRIu64 " further occurrences of this message (duplicate_message_limit is %u).",
+                       message.count, debug_data->duplicate_messages->Limit());
+        debug_log_msg(debug_data, message.msg_flags, message.object_type, message.object, 0, "Validation", summary.c_str(),
+                      message.vuid.c_str());
+    }
+}
+
+static inline std::string FormatReportLogMessage(VkFlags msg_flags, int32_t msg_code, const char *layer_prefix, const char *message) {
     std::ostringstream msg_buffer;
     char msg_flag_string[30];
 
     PrintMessageFlags(msg_flags, msg_flag_string);
 
     msg_buffer << layer_prefix << "(" << msg_flag_string << "): msg_code: " << msg_code << ": " << message << "\n";
-    const std::string tmp = msg_buffer.str();
+    return msg_buffer.str();
+}
+
+static inline VKAPI_ATTR VkBool32 VKAPI_CALL report_log_callback(VkFlags msg_flags, VkDebugReportObjectTypeEXT obj_type,
+                                                                 uint64_t src_object, size_t location, int32_t msg_code,
+                                                                 const char *layer_prefix, const char *message, void *user_data) {
+    const std::string tmp = FormatReportLogMessage(msg_flags, msg_code, layer_prefix, message);
     const char *cstr = tmp.c_str();
 
     fprintf((FILE *)user_data, "%s", cstr);
@@ -1036,6 +1494,21 @@ static inline VKAPI_ATTR VkBool32 VKAPI_CALL report_log_callback(VkFlags msg_fla
     return false;
 }
 
+// As report_log_callback, but user_data is an AsyncLogSink that writes the message out in the background
+static inline VKAPI_ATTR VkBool32 VKAPI_CALL report_async_log_callback(VkFlags msg_flags, VkDebugReportObjectTypeEXT obj_type,
+                                                                       uint64_t src_object, size_t location, int32_t msg_code,
+                                                                       const char *layer_prefix, const char *message,
+                                                                       void *user_data) {
+    std::string tmp = FormatReportLogMessage(msg_flags, msg_code, layer_prefix, message);
+
+#if defined __ANDROID__
+    LOGCONSOLE("%s", tmp.c_str());
+#endif
+
+    static_cast<AsyncLogSink *>(user_data)->Write(std::move(tmp));
+    return false;
+}
+
 static inline VKAPI_ATTR VkBool32 VKAPI_CALL report_win32_debug_output_msg(VkFlags msg_flags, VkDebugReportObjectTypeEXT obj_type,
                                                                            uint64_t src_object, size_t location, int32_t msg_code,
                                                                            const char *layer_prefix, const char *message,
@@ -1065,10 +1538,9 @@ static inline VKAPI_ATTR VkBool32 VKAPI_CALL DebugBreakCallback(VkFlags msgFlags
     return false;
 }
 
-static inline VKAPI_ATTR VkBool32 VKAPI_CALL messenger_log_callback(VkDebugUtilsMessageSeverityFlagBitsEXT message_severity,
-                                                                    VkDebugUtilsMessageTypeFlagsEXT message_type,
-                                                                    const VkDebugUtilsMessengerCallbackDataEXT *callback_data,
-                                                                    void *user_data) {
+static inline std::string FormatMessengerLogMessage(VkDebugUtilsMessageSeverityFlagBitsEXT message_severity,
+                                                    VkDebugUtilsMessageTypeFlagsEXT message_type,
+                                                    const VkDebugUtilsMessengerCallbackDataEXT *callback_data) {
     std::ostringstream msg_buffer;
     char msg_severity[30];
     char msg_type[30];
@@ -1086,7 +1558,14 @@ static inline VKAPI_ATTR VkBool32 VKAPI_CALL messenger_log_callback(VkDebugUtils
                    << ", name: " << (callback_data->pObjects[obj].pObjectName ? callback_data->pObjects[obj].pObjectName : "NULL")
                    << "\n";
     }
-    const std::string tmp = msg_buffer.str();
+    return msg_buffer.str();
+}
+
+static inline VKAPI_ATTR VkBool32 VKAPI_CALL messenger_log_callback(VkDebugUtilsMessageSeverityFlagBitsEXT message_severity,
+                                                                    VkDebugUtilsMessageTypeFlagsEXT message_type,
+                                                                    const VkDebugUtilsMessengerCallbackDataEXT *callback_data,
+                                                                    void *user_data) {
+    const std::string tmp = FormatMessengerLogMessage(message_severity, message_type, callback_data);
     const char *cstr = tmp.c_str();
     fprintf((FILE *)user_data, "%s", cstr);
     fflush((FILE *)user_data);
@@ -1098,6 +1577,162 @@ static inline VKAPI_ATTR VkBool32 VKAPI_CALL messenger_log_callback(VkDebugUtils
     return false;
 }
 
+// As messenger_log_callback, but user_data is an AsyncLogSink that writes the message out in the background
+static inline VKAPI_ATTR VkBool32 VKAPI_CALL messenger_async_log_callback(VkDebugUtilsMessageSeverityFlagBitsEXT message_severity,
+                                                                          VkDebugUtilsMessageTypeFlagsEXT message_type,
+                                                                          const VkDebugUtilsMessengerCallbackDataEXT *callback_data,
+                                                                          void *user_data) {
+    std::string tmp = FormatMessengerLogMessage(message_severity, message_type, callback_data);
+
+#if defined __ANDROID__
+    LOGCONSOLE("%s", tmp.c_str());
+#endif
+
+    static_cast<AsyncLogSink *>(user_data)->Write(std::move(tmp));
+    return false;
+}
+
+// The file header of the binary log format: a magic number and the format version, both 32-bit little-endian. Each record that
+// follows is a 32-bit byte count and then these fields:
+//   u64 timestamp (ns since the epoch), u64 thread id, u32 severity bit, u32 message type flags,
+//   str VUID, str message,
+//   u32 object count, then per object: u64 handle, u32 VkObjectType, str name,
+//   u32 queue label count, str per label, u32 command buffer label count, str per label
+// where a str is a u32 byte count followed by that many UTF-8 bytes. scripts/vk_validation_log_reader.py reads this format.
+static const uint32_t kBinaryLogMagic = 0x424c5656;  // "VVLB"
+static const uint32_t kBinaryLogVersion = 1;
+
+static inline void AppendBinaryLogValue(std::string *record, uint32_t value) {
+    for (int byte = 0; byte < 4; ++byte) record->push_back(static_cast<char>((value >> (8 * byte)) & 0xff));
+}
+
+static inline void AppendBinaryLogValue(std::string *record, uint64_t value) {
+    for (int byte = 0; byte < 8; ++byte) record->push_back(static_cast<char>((value >> (8 * byte)) & 0xff));
+}
+
+static inline void AppendBinaryLogValue(std::string *record, const char *value) {
+    const uint32_t length = value ? static_cast<uint32_t>(strlen(value)) : 0;
+    AppendBinaryLogValue(record, length);
+    record->append(value ? value : "", length);
+}
+
+static inline std::string BinaryLogHeader() {
+    std::string header;
+    AppendBinaryLogValue(&header, kBinaryLogMagic);
+    AppendBinaryLogValue(&header, kBinaryLogVersion);
+    return header;
+}
+
+static inline void AppendJsonString(std::string *record, const char *value) {
+    record->push_back('"');
+    for (const char *c = value ? value : ""; *c; ++c) {
+        switch (*c) {
+            case '"':
+                record->append("\\\"");
+                break;
+            case '\\':
+                record->append("\\\\");
+                break;
+            case '\n':
+                record->append("\\n");
+                break;
+            case '\t':
+                record->append("\\t");
+                break;
+            default:
+                if (static_cast<unsigned char>(*c) < 0x20) {
+                    char escape[8];
+                    snprintf(escape, sizeof(escape), "\\u%04x", static_cast<unsigned char>(*c));
+                    record->append(escape);
+                } else {
+                    record->push_back(*c);
+                }
+        }
+    }
+    record->push_back('"');
+}
+
+// Writes each message as a JSON line or binary record, per the log_format setting. user_data is a StructuredLogOutput.
+static inline VKAPI_ATTR VkBool32 VKAPI_CALL messenger_structured_log_callback(
+    VkDebugUtilsMessageSeverityFlagBitsEXT message_severity, VkDebugUtilsMessageTypeFlagsEXT message_type,
+    const VkDebugUtilsMessengerCallbackDataEXT *callback_data, void *user_data) {
+    auto target = static_cast<StructuredLogOutput *>(user_data);
+    const uint64_t timestamp =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    const uint64_t thread_id = std::hash<std::thread::id>()(std::this_thread::get_id());
+
+    // Validation messages carry their spec text, which the VUID already identifies
+    std::string message = callback_data->pMessage ? callback_data->pMessage : "";
+    const size_t spec_text = message.find(" The Vulkan spec states: ");
+    if (spec_text != std::string::npos) message.resize(spec_text);
+
+    std::string record;
+    if (target->format == kLogFormatBinary) {
+        record.resize(4);  // Byte count, filled in below
+        AppendBinaryLogValue(&record, timestamp);
+        AppendBinaryLogValue(&record, thread_id);
+        AppendBinaryLogValue(&record, static_cast<uint32_t>(message_severity));
+        AppendBinaryLogValue(&record, static_cast<uint32_t>(message_type));
+        AppendBinaryLogValue(&record, callback_data->pMessageIdName);
+        AppendBinaryLogValue(&record, message.c_str());
+        AppendBinaryLogValue(&record, callback_data->objectCount);
+        for (uint32_t obj = 0; obj < callback_data->objectCount; ++obj) {
+            AppendBinaryLogValue(&record, static_cast<uint64_t>(callback_data->pObjects[obj].objectHandle));
+            AppendBinaryLogValue(&record, static_cast<uint32_t>(callback_data->pObjects[obj].objectType));
+            AppendBinaryLogValue(&record, callback_data->pObjects[obj].pObjectName);
+        }
+        AppendBinaryLogValue(&record, callback_data->queueLabelCount);
+        for (uint32_t label = 0; label < callback_data->queueLabelCount; ++label) {
+            AppendBinaryLogValue(&record, callback_data->pQueueLabels[label].pLabelName);
+        }
+        AppendBinaryLogValue(&record, callback_data->cmdBufLabelCount);
+        for (uint32_t label = 0; label < callback_data->cmdBufLabelCount; ++label) {
+            AppendBinaryLogValue(&record, callback_data->pCmdBufLabels[label].pLabelName);
+        }
+        std::string size;
+        AppendBinaryLogValue(&size, static_cast<uint32_t>(record.size() - 4));
+        record.replace(0, 4, size);
+    } else {
+        char severity[30];
+        char handle[24];
+        PrintMessageSeverity(message_severity, severity);
+        record = "{\"time_ns\": " + std::to_string(timestamp) + ", \"thread\": " + std::to_string(thread_id) + ", \"vuid\": ";
+        AppendJsonString(&record, callback_data->pMessageIdName);
+        record += ", \"severity\": ";
+        AppendJsonString(&record, severity);
+        record += ", \"type\": " + std::to_string(message_type) + ", \"objects\": [";
+        for (uint32_t obj = 0; obj < callback_data->objectCount; ++obj) {
+            snprintf(handle, sizeof(handle), "0x%" PRIx64, static_cast<uint64_t>(callback_data->pObjects[obj].objectHandle));
+            record += obj ? ", {\"handle\": \"" : "{\"handle\": \"";
+            record += handle;
+            record += "\", \"type\": " + std::to_string(callback_data->pObjects[obj].objectType) + ", \"name\": ";
+            AppendJsonString(&record, callback_data->pObjects[obj].pObjectName);
+            record += "}";
+        }
+        record += "], \"queue_labels\": [";
+        for (uint32_t label = 0; label < callback_data->queueLabelCount; ++label) {
+            if (label) record += ", ";
+            AppendJsonString(&record, callback_data->pQueueLabels[label].pLabelName);
+        }
+        record += "], \"cmd_buf_labels\": [";
+        for (uint32_t label = 0; label < callback_data->cmdBufLabelCount; ++label) {
+            if (label) record += ", ";
+            AppendJsonString(&record, callback_data->pCmdBufLabels[label].pLabelName);
+        }
+        record += "], \"message\": ";
+        AppendJsonString(&record, message.c_str());
+        record += "}\n";
+    }
+
+    if (target->async_sink) {
+        target->async_sink->Write(std::move(record));
+    } else {
+        fwrite(record.data(), 1, record.size(), target->output);
+        fflush(target->output);
+    }
+    return false;
+}
+
 static inline VKAPI_ATTR VkBool32 VKAPI_CALL messenger_win32_debug_output_msg(
     VkDebugUtilsMessageSeverityFlagBitsEXT message_severity, VkDebugUtilsMessageTypeFlagsEXT message_type,
     const VkDebugUtilsMessengerCallbackDataEXT *callback_data, void *user_data) {
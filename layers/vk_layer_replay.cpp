@@ -0,0 +1,525 @@
+/* Copyright (c) 2019 The Khronos Group Inc.
+ * Copyright (c) 2019 Valve Corporation
+ * Copyright (c) 2019 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// The replay of API captures through the validation objects, and the down-chain stubs that stand in for the driver. The
+// vk_layer_replay tool in vk_layer_replay_main.cpp drives it.
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "chassis.h"
+#include "chassis_capture.h"
+#include "vk_layer_config.h"
+#include "vk_layer_replay.h"
+
+namespace vulkan_layer_replay {
+
+thread_local ReplayContext *ReplayContext::current_ = nullptr;
+
+// A capture file mapped read-only into memory
+class MappedCaptureFile {
+   public:
+    explicit MappedCaptureFile(const std::string &path) {
+#ifdef _WIN32
+        file_ = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file_ == INVALID_HANDLE_VALUE) return;
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(file_, &size) || size.QuadPart == 0) return;
+        mapping_ = CreateFileMappingA(file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!mapping_) return;
+        data_ = static_cast<const uint8_t *>(MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0));
+        if (data_) size_ = static_cast<size_t>(size.QuadPart);
+#else
+        const int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0) return;
+        struct stat status;
+        if (fstat(fd, &status) == 0 && status.st_size > 0) {
+            void *data = mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+            if (data != MAP_FAILED) {
+                data_ = static_cast<const uint8_t *>(data);
+                size_ = static_cast<size_t>(status.st_size);
+            }
+        }
+        close(fd);
+#endif
+    }
+
+    ~MappedCaptureFile() {
+#ifdef _WIN32
+        if (data_) UnmapViewOfFile(data_);
+        if (mapping_) CloseHandle(mapping_);
+        if (file_ != INVALID_HANDLE_VALUE) CloseHandle(file_);
+#else
+        if (data_) munmap(const_cast<uint8_t *>(data_), size_);
+#endif
+    }
+
+    MappedCaptureFile(const MappedCaptureFile &) = delete;
+    MappedCaptureFile &operator=(const MappedCaptureFile &) = delete;
+
+    const uint8_t *data() const { return data_; }
+    size_t size() const { return size_; }
+
+   private:
+#ifdef _WIN32
+    HANDLE file_ = INVALID_HANDLE_VALUE;
+    HANDLE mapping_ = nullptr;
+#endif
+    const uint8_t *data_ = nullptr;
+    size_t size_ = 0;
+};
+
+// Reads the fields of the capture file header and record headers, failing on a short read
+class CaptureFileReader {
+   public:
+    CaptureFileReader(const uint8_t *data, size_t size) : data_(data), size_(size) {}
+
+    bool Read(void *value, size_t size) {
+        if (size > size_ - offset_) return false;
+        memcpy(value, data_ + offset_, size);
+        offset_ += size;
+        return true;
+    }
+    template <typename T>
+    bool Read(T &value) {
+        return Read(&value, sizeof(T));
+    }
+
+    const uint8_t *Current() const { return data_ + offset_; }
+    size_t Remaining() const { return size_ - offset_; }
+    void Skip(size_t size) { offset_ += size; }
+
+   private:
+    const uint8_t *data_;
+    size_t size_;
+    size_t offset_ = 0;
+};
+
+struct ReplayRecord {
+    uint64_t sequence;
+    uint32_t command;
+    const uint8_t *payload;
+    size_t size;
+};
+
+static void DecodePhysicalDeviceState(ReplayContext &context, const ReplayRecord &record, ReplaySummary &summary) {
+    ApiCaptureDecoder decoder(context, context.state_arena(), record.payload, record.size);
+    ReplayPhysicalDeviceState state;
+    const uint64_t gpu = decoder.Read<uint64_t>();
+    decoder.Value(state.properties);
+    decoder.Value(state.features);
+    decoder.Value(state.memory_properties);
+    const VkQueueFamilyProperties *queue_families = nullptr;
+    const uint64_t queue_family_count = decoder.Array(queue_families);
+    const VkFormatProperties *format_properties = nullptr;
+    const uint64_t format_count = decoder.Array(format_properties);
+    state.extension_properties = CaptureDecodePNext(decoder);
+    if (!decoder.Finished()) {
+        ++summary.malformed;
+        return;
+    }
+    if (queue_families) state.queue_families.assign(queue_families, queue_families + queue_family_count);
+    if (format_properties) state.format_properties.assign(format_properties, format_properties + format_count);
+    context.AddPhysicalDeviceState(gpu) = std::move(state);
+}
+
+void ReplayPrepareSettings() {
+    setLayerOption(OBJECT_LAYER_DESCRIPTION ".deferred_validation_threads", "0");
+}
+
+// Records are replayed in the order their calls returned, whichever thread made them
+ReplaySummary ReplayCapture(ReplayContext &context) {
+    ReplaySummary summary;
+    MappedCaptureFile file(context.name());
+    if (!file.data()) {
+        summary.error = "cannot read file";
+        return summary;
+    }
+    CaptureFileReader reader(file.data(), file.size());
+    uint32_t magic = 0, version = 0, pointer_size = 0, command_count = 0;
+    if (!reader.Read(magic) || !reader.Read(version) || !reader.Read(pointer_size) || !reader.Read(command_count) ||
+        magic != ApiCapture::kMagic) {
+        summary.error = "not an API capture";
+        return summary;
+    }
+    if (version != ApiCapture::kVersion) {
+        summary.error = "unsupported capture version " + std::to_string(version);
+        return summary;
+    }
+    if (pointer_size != sizeof(void *)) {
+        summary.error = "captured with " + std::to_string(pointer_size * 8) + "-bit pointers";
+        return summary;
+    }
+
+    // Map the command indices of the capture to the CaptureIds of this build, which may know other platform extensions
+    std::unordered_map<std::string, uint32_t> capture_ids;
+    for (uint32_t id = 0; id < CaptureIdCount; ++id) capture_ids[capture_id_names[id]] = id;
+    std::vector<uint32_t> commands(command_count, CaptureIdCount);
+    for (uint32_t index = 0; index < command_count; ++index) {
+        uint32_t length = 0;
+        if (!reader.Read(length) || length > reader.Remaining()) {
+            summary.error = "truncated header";
+            return summary;
+        }
+        auto it = capture_ids.find(std::string(reinterpret_cast<const char *>(reader.Current()), length));
+        if (it != capture_ids.end()) commands[index] = it->second;
+        reader.Skip(length);
+    }
+
+    std::vector<ReplayRecord> records;
+    while (reader.Remaining()) {
+        uint32_t size = 0;
+        ReplayRecord record = {};
+        uint32_t thread_index = 0, command_index = 0;
+        if (!reader.Read(size) || size > reader.Remaining() || size < sizeof(uint64_t) + 2 * sizeof(uint32_t)) {
+            summary.truncated = true;
+            break;
+        }
+        reader.Read(record.sequence);
+        reader.Read(thread_index);
+        reader.Read(command_index);
+        record.command = command_index < command_count ? commands[command_index] : CaptureIdCount;
+        record.payload = reader.Current();
+        record.size = size - sizeof(uint64_t) - 2 * sizeof(uint32_t);
+        reader.Skip(record.size);
+        // Physical device state is queried by the validation objects whenever they need it, so it is all read up front
+        if (record.command == CaptureIdPhysicalDeviceState) {
+            DecodePhysicalDeviceState(context, record, summary);
+        } else {
+            records.push_back(record);
+        }
+    }
+    std::stable_sort(records.begin(), records.end(),
+                     [](const ReplayRecord &a, const ReplayRecord &b) { return a.sequence < b.sequence; });
+
+    ReplayContext::SetCurrent(&context);
+    for (const auto &record : records) {
+        const ReplayFunction replay = record.command < CaptureIdCount ? replay_functions[record.command] : nullptr;
+        if (!replay) {
+            ++summary.skipped;
+            continue;
+        }
+        context.BeginRecord();
+        ApiCaptureDecoder decoder(context, context.record_arena(), record.payload, record.size);
+        if (replay(context, decoder)) {
+            ++summary.replayed;
+        } else {
+            ++summary.malformed;
+        }
+    }
+    ReplayContext::SetCurrent(nullptr);
+    return summary;
+}
+
+std::vector<ReplaySummary> ReplayCaptures(const std::vector<std::unique_ptr<ReplayContext>> &contexts, uint32_t jobs) {
+    std::vector<ReplaySummary> summaries(contexts.size());
+    std::atomic<size_t> next_capture{0};
+    auto worker = [&]() {
+        for (size_t index = next_capture++; index < contexts.size(); index = next_capture++) {
+            summaries[index] = ReplayCapture(*contexts[index]);
+        }
+    };
+    std::vector<std::thread> workers;
+    for (uint32_t i = 1; i < std::min<size_t>(jobs, contexts.size()); ++i) workers.emplace_back(worker);
+    worker();
+    for (auto &thread : workers) thread.join();
+    return summaries;
+}
+
+// Down-chain stubs that do more than return the recorded result. Outside of the call being replayed they answer the
+// validation objects' own queries: from the recorded physical device state, or permissively where nothing was recorded.
+
+// True while the intercept of the given command is being replayed on this thread
+static bool StubReplayingCommand(uint32_t command) {
+    const ReplayContext *context = ReplayContext::Current();
+    return context && context->command() == command;
+}
+
+// The recorded state of a physical device, for the queries of the validation objects outside of the call being replayed
+static const ReplayPhysicalDeviceState *StubPhysicalDeviceState(uint32_t command, VkPhysicalDevice physicalDevice) {
+    const ReplayContext *context = ReplayContext::Current();
+    if (!context || context->command() == command) return nullptr;
+    return context->PhysicalDeviceState(physicalDevice);
+}
+
+VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL StubGetInstanceProcAddr(VkInstance instance, const char *pName) {
+    auto it = replay_stub_functions.find(pName);
+    return it == replay_stub_functions.end() ? nullptr : it->second;
+}
+
+VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL StubGetDeviceProcAddr(VkDevice device, const char *pName) {
+    return StubGetInstanceProcAddr(VK_NULL_HANDLE, pName);
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL StubAllocateMemory(VkDevice device, const VkMemoryAllocateInfo *pAllocateInfo,
+                                                  const VkAllocationCallbacks *pAllocator, VkDeviceMemory *pMemory) {
+    const VkResult result = StubResult<VkResult>(CaptureIdAllocateMemory);
+    ReplayContext *context = ReplayContext::Current();
+    if (context && result == VK_SUCCESS && pAllocateInfo && pMemory) {
+        context->AllocateMemory(HandleToUint64(*pMemory), pAllocateInfo->allocationSize);
+    }
+    return result;
+}
+
+VKAPI_ATTR void VKAPI_CALL StubFreeMemory(VkDevice device, VkDeviceMemory memory, const VkAllocationCallbacks *pAllocator) {
+    ReplayContext *context = ReplayContext::Current();
+    if (context) context->FreeMemory(HandleToUint64(memory));
+}
+
+// CoreChecks copies the shadow of non-coherent memory to the pointer the driver returned, so the mapping must be real
+VKAPI_ATTR VkResult VKAPI_CALL StubMapMemory(VkDevice device, VkDeviceMemory memory, VkDeviceSize offset, VkDeviceSize size,
+                                             VkMemoryMapFlags flags, void **ppData) {
+    const VkResult result = StubResult<VkResult>(CaptureIdMapMemory);
+    ReplayContext *context = ReplayContext::Current();
+    if (context && result == VK_SUCCESS && ppData) *ppData = context->MapMemory(HandleToUint64(memory), offset, size);
+    return result;
+}
+
+static void StubPermissiveMemoryRequirements(VkMemoryRequirements *pMemoryRequirements) {
+    pMemoryRequirements->size = 0;
+    pMemoryRequirements->alignment = 1;
+    pMemoryRequirements->memoryTypeBits = ~0u;
+}
+
+VKAPI_ATTR void VKAPI_CALL StubGetBufferMemoryRequirements(VkDevice device, VkBuffer buffer,
+                                                           VkMemoryRequirements *pMemoryRequirements) {
+    if (!StubReplayingCommand(CaptureIdGetBufferMemoryRequirements)) {
+        StubPermissiveMemoryRequirements(pMemoryRequirements);
+    }
+}
+
+VKAPI_ATTR void VKAPI_CALL StubGetImageMemoryRequirements(VkDevice device, VkImage image,
+                                                          VkMemoryRequirements *pMemoryRequirements) {
+    if (!StubReplayingCommand(CaptureIdGetImageMemoryRequirements)) {
+        StubPermissiveMemoryRequirements(pMemoryRequirements);
+    }
+}
+
+VKAPI_ATTR void VKAPI_CALL StubGetPhysicalDeviceProperties(VkPhysicalDevice physicalDevice,
+                                                           VkPhysicalDeviceProperties *pProperties) {
+    const ReplayPhysicalDeviceState *state = StubPhysicalDeviceState(CaptureIdGetPhysicalDeviceProperties, physicalDevice);
+    if (state) *pProperties = state->properties;
+}
+
+static void StubGetPhysicalDeviceProperties2(uint32_t command, VkPhysicalDevice physicalDevice,
+                                             VkPhysicalDeviceProperties2 *pProperties) {
+    const ReplayPhysicalDeviceState *state = StubPhysicalDeviceState(command, physicalDevice);
+    if (!state) return;
+    pProperties->properties = state->properties;
+    for (auto *item = static_cast<VkBaseOutStructure *>(pProperties->pNext); item; item = item->pNext) {
+        for (auto *recorded = static_cast<const VkBaseOutStructure *>(state->extension_properties); recorded;
+             recorded = recorded->pNext) {
+            const size_t size = CaptureStructureSize(recorded->sType);
+            if (recorded->sType != item->sType || size < sizeof(VkBaseOutStructure)) continue;
+            memcpy(reinterpret_cast<uint8_t *>(item) + sizeof(VkBaseOutStructure),
+                   reinterpret_cast<const uint8_t *>(recorded) + sizeof(VkBaseOutStructure), size - sizeof(VkBaseOutStructure));
+            break;
+        }
+    }
+}
+
+VKAPI_ATTR void VKAPI_CALL StubGetPhysicalDeviceProperties2(VkPhysicalDevice physicalDevice,
+                                                            VkPhysicalDeviceProperties2 *pProperties) {
+    StubGetPhysicalDeviceProperties2(CaptureIdGetPhysicalDeviceProperties2, physicalDevice, pProperties);
+}
+
+VKAPI_ATTR void VKAPI_CALL StubGetPhysicalDeviceProperties2KHR(VkPhysicalDevice physicalDevice,
+                                                               VkPhysicalDeviceProperties2 *pProperties) {
+    StubGetPhysicalDeviceProperties2(CaptureIdGetPhysicalDeviceProperties2KHR, physicalDevice, pProperties);
+}
+
+VKAPI_ATTR void VKAPI_CALL StubGetPhysicalDeviceFeatures(VkPhysicalDevice physicalDevice, VkPhysicalDeviceFeatures *pFeatures) {
+    const ReplayPhysicalDeviceState *state = StubPhysicalDeviceState(CaptureIdGetPhysicalDeviceFeatures, physicalDevice);
+    if (state) *pFeatures = state->features;
+}
+
+VKAPI_ATTR void VKAPI_CALL StubGetPhysicalDeviceMemoryProperties(VkPhysicalDevice physicalDevice,
+                                                                 VkPhysicalDeviceMemoryProperties *pMemoryProperties) {
+    const ReplayPhysicalDeviceState *state = StubPhysicalDeviceState(CaptureIdGetPhysicalDeviceMemoryProperties, physicalDevice);
+    if (state) *pMemoryProperties = state->memory_properties;
+}
+
+VKAPI_ATTR void VKAPI_CALL StubGetPhysicalDeviceQueueFamilyProperties(VkPhysicalDevice physicalDevice,
+                                                                      uint32_t *pQueueFamilyPropertyCount,
+                                                                      VkQueueFamilyProperties *pQueueFamilyProperties) {
+    const ReplayPhysicalDeviceState *state = StubPhysicalDeviceState(CaptureIdGetPhysicalDeviceQueueFamilyProperties, physicalDevice);
+    if (!state) return;
+    const uint32_t count = static_cast<uint32_t>(state->queue_families.size());
+    if (pQueueFamilyProperties) {
+        *pQueueFamilyPropertyCount = std::min(*pQueueFamilyPropertyCount, count);
+        std::copy_n(state->queue_families.begin(), *pQueueFamilyPropertyCount, pQueueFamilyProperties);
+    } else {
+        *pQueueFamilyPropertyCount = count;
+    }
+}
+
+// Only the core formats are recorded; extension formats report no features
+VKAPI_ATTR void VKAPI_CALL StubGetPhysicalDeviceFormatProperties(VkPhysicalDevice physicalDevice, VkFormat format,
+                                                                 VkFormatProperties *pFormatProperties) {
+    const ReplayPhysicalDeviceState *state = StubPhysicalDeviceState(CaptureIdGetPhysicalDeviceFormatProperties, physicalDevice);
+    if (!state) return;
+    const size_t index = static_cast<size_t>(format);
+    *pFormatProperties = index < state->format_properties.size() ? state->format_properties[index] : VkFormatProperties{};
+}
+
+static void StubPermissiveImageFormatProperties(VkImageFormatProperties *pImageFormatProperties) {
+    pImageFormatProperties->maxExtent = {UINT32_MAX, UINT32_MAX, UINT32_MAX};
+    pImageFormatProperties->maxMipLevels = UINT32_MAX;
+    pImageFormatProperties->maxArrayLayers = UINT32_MAX;
+    pImageFormatProperties->sampleCounts = VK_SAMPLE_COUNT_FLAG_BITS_MAX_ENUM;
+    pImageFormatProperties->maxResourceSize = UINT64_MAX;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL StubGetPhysicalDeviceImageFormatProperties(VkPhysicalDevice physicalDevice, VkFormat format,
+                                                                          VkImageType type, VkImageTiling tiling,
+                                                                          VkImageUsageFlags usage, VkImageCreateFlags flags,
+                                                                          VkImageFormatProperties *pImageFormatProperties) {
+    if (!StubReplayingCommand(CaptureIdGetPhysicalDeviceImageFormatProperties)) {
+        StubPermissiveImageFormatProperties(pImageFormatProperties);
+    }
+    return StubResult<VkResult>(CaptureIdGetPhysicalDeviceImageFormatProperties);
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL StubGetPhysicalDeviceImageFormatProperties2(VkPhysicalDevice physicalDevice,
+                                                                           const VkPhysicalDeviceImageFormatInfo2 *pImageFormatInfo,
+                                                                           VkImageFormatProperties2 *pImageFormatProperties) {
+    if (!StubReplayingCommand(CaptureIdGetPhysicalDeviceImageFormatProperties2)) {
+        StubPermissiveImageFormatProperties(&pImageFormatProperties->imageFormatProperties);
+    }
+    return StubResult<VkResult>(CaptureIdGetPhysicalDeviceImageFormatProperties2);
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL StubGetPhysicalDeviceImageFormatProperties2KHR(
+    VkPhysicalDevice physicalDevice, const VkPhysicalDeviceImageFormatInfo2 *pImageFormatInfo,
+    VkImageFormatProperties2 *pImageFormatProperties) {
+    if (!StubReplayingCommand(CaptureIdGetPhysicalDeviceImageFormatProperties2KHR)) {
+        StubPermissiveImageFormatProperties(&pImageFormatProperties->imageFormatProperties);
+    }
+    return StubResult<VkResult>(CaptureIdGetPhysicalDeviceImageFormatProperties2KHR);
+}
+
+static VKAPI_ATTR VkBool32 VKAPI_CALL ReplayMessengerCallback(VkDebugUtilsMessageSeverityFlagBitsEXT severity,
+                                                              VkDebugUtilsMessageTypeFlagsEXT types,
+                                                              const VkDebugUtilsMessengerCallbackDataEXT *callback_data,
+                                                              void *user_data) {
+    static_cast<ReplayContext *>(user_data)->CountMessage(severity);
+    return VK_FALSE;
+}
+
+// Unlink the structures of a create info chain that would make the layer call back into the captured application, or that
+// would override the validation settings of the replay machine
+static const void *ReplayFilterCreateInfoChain(const void *chain) {
+    const VkBaseOutStructure *head = nullptr;
+    VkBaseOutStructure *tail = nullptr;
+    for (auto *item = static_cast<VkBaseOutStructure *>(const_cast<void *>(chain)); item; item = item->pNext) {
+        switch (item->sType) {
+            case VK_STRUCTURE_TYPE_DEBUG_REPORT_CALLBACK_CREATE_INFO_EXT:
+            case VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CREATE_INFO_EXT:
+            case VK_STRUCTURE_TYPE_VALIDATION_FEATURES_EXT:
+            case VK_STRUCTURE_TYPE_VALIDATION_FLAGS_EXT:
+                continue;
+            default:
+                break;
+        }
+        if (tail) {
+            tail->pNext = item;
+        } else {
+            head = item;
+        }
+        tail = item;
+    }
+    if (tail) tail->pNext = nullptr;
+    return head;
+}
+
+void ReplayManualCreateInstance(ReplayContext &context, const VkInstanceCreateInfo *pCreateInfo,
+                                const VkAllocationCallbacks *pAllocator, VkInstance *pInstance, VkResult result) {
+    if (!pCreateInfo || !pInstance || result != VK_SUCCESS) return;
+    VkLayerInstanceLink link = {};
+    link.pfnNextGetInstanceProcAddr = StubGetInstanceProcAddr;
+    VkLayerInstanceCreateInfo layer_info = {};
+    layer_info.sType = VK_STRUCTURE_TYPE_LOADER_INSTANCE_CREATE_INFO;
+    layer_info.function = VK_LAYER_LINK_INFO;
+    layer_info.u.pLayerInfo = &link;
+    layer_info.pNext = ReplayFilterCreateInfoChain(pCreateInfo->pNext);
+    VkInstanceCreateInfo create_info = *pCreateInfo;
+    create_info.pNext = &layer_info;
+    if (vulkan_layer_chassis::CreateInstance(&create_info, pAllocator, pInstance) != VK_SUCCESS) return;
+
+    // Count the messages reported against the instance and its devices
+    VkDebugUtilsMessengerCreateInfoEXT messenger_info = {};
+    messenger_info.sType = VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CREATE_INFO_EXT;
+    messenger_info.messageSeverity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT | VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT;
+    messenger_info.messageType = VK_DEBUG_UTILS_MESSAGE_TYPE_GENERAL_BIT_EXT | VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT |
+                                 VK_DEBUG_UTILS_MESSAGE_TYPE_PERFORMANCE_BIT_EXT;
+    messenger_info.pfnUserCallback = ReplayMessengerCallback;
+    messenger_info.pUserData = &context;
+    auto layer_data = GetLayerDataPtr(get_dispatch_key(*pInstance), layer_data_map);
+    VkDebugUtilsMessengerEXT messenger = VK_NULL_HANDLE;
+    if (layer_create_messenger_callback(layer_data->report_data, false, &messenger_info, nullptr, &messenger) == VK_SUCCESS) {
+        layer_data->logging_messenger.push_back(messenger);
+    }
+}
+
+void ReplayManualCreateDevice(ReplayContext &context, VkPhysicalDevice physicalDevice, const VkDeviceCreateInfo *pCreateInfo,
+                              const VkAllocationCallbacks *pAllocator, VkDevice *pDevice, VkResult result) {
+    if (!pCreateInfo || !pDevice || result != VK_SUCCESS) return;
+    VkLayerDeviceLink link = {};
+    link.pfnNextGetInstanceProcAddr = StubGetInstanceProcAddr;
+    link.pfnNextGetDeviceProcAddr = StubGetDeviceProcAddr;
+    VkLayerDeviceCreateInfo layer_info = {};
+    layer_info.sType = VK_STRUCTURE_TYPE_LOADER_DEVICE_CREATE_INFO;
+    layer_info.function = VK_LAYER_LINK_INFO;
+    layer_info.u.pLayerInfo = &link;
+    layer_info.pNext = pCreateInfo->pNext;
+    VkDeviceCreateInfo create_info = *pCreateInfo;
+    create_info.pNext = &layer_info;
+    vulkan_layer_chassis::CreateDevice(physicalDevice, &create_info, pAllocator, pDevice);
+}
+
+// The callbacks of the captured application cannot be called, so its messengers and report callbacks are not replayed
+void ReplayManualCreateDebugUtilsMessengerEXT(ReplayContext &context, VkInstance instance,
+                                              const VkDebugUtilsMessengerCreateInfoEXT *pCreateInfo,
+                                              const VkAllocationCallbacks *pAllocator, VkDebugUtilsMessengerEXT *pMessenger,
+                                              VkResult result) {}
+
+void ReplayManualDestroyDebugUtilsMessengerEXT(ReplayContext &context, VkInstance instance, VkDebugUtilsMessengerEXT messenger,
+                                               const VkAllocationCallbacks *pAllocator) {}
+
+void ReplayManualCreateDebugReportCallbackEXT(ReplayContext &context, VkInstance instance,
+                                              const VkDebugReportCallbackCreateInfoEXT *pCreateInfo,
+                                              const VkAllocationCallbacks *pAllocator, VkDebugReportCallbackEXT *pCallback,
+                                              VkResult result) {}
+
+void ReplayManualDestroyDebugReportCallbackEXT(ReplayContext &context, VkInstance instance, VkDebugReportCallbackEXT callback,
+                                               const VkAllocationCallbacks *pAllocator) {}
+
+}  // namespace vulkan_layer_replay
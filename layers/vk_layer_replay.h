@@ -0,0 +1,357 @@
+/* Copyright (c) 2019 The Khronos Group Inc.
+ * Copyright (c) 2019 Valve Corporation
+ * Copyright (c) 2019 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VK_LAYER_REPLAY_H
+#define VK_LAYER_REPLAY_H
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "vulkan/vulkan.h"
+#include "vk_layer_utils.h"
+
+// The offline replayer reads the capture files that ApiCapture writes and passes each call through the layer chassis, and so
+// through the validation objects, in the order the calls returned. The chassis calls down to stubs instead of a driver: a
+// stub returns the result recorded for the call being replayed, and the outputs of the call are already set, because the
+// replay decodes them from the record along with the inputs.
+namespace vulkan_layer_replay {
+
+// Zeroed memory for the decoded parameters of a record, released all at once
+class ReplayArena {
+   public:
+    static const size_t kBlockSize = 64 * 1024;
+    static const size_t kAlignment = 16;
+
+    void *Allocate(size_t size) {
+        size = (size + kAlignment - 1) & ~(kAlignment - 1);
+        if (size > kBlockSize / 4) {
+            large_blocks_.emplace_back(new uint8_t[size]());
+            return large_blocks_.back().get();
+        }
+        if (blocks_.empty() || offset_ + size > kBlockSize) {
+            if (blocks_.empty() || ++block_ == blocks_.size()) {
+                blocks_.emplace_back(new uint8_t[kBlockSize]);
+                block_ = blocks_.size() - 1;
+            }
+            offset_ = 0;
+        }
+        uint8_t *memory = blocks_[block_].get() + offset_;
+        offset_ += size;
+        memset(memory, 0, size);
+        return memory;
+    }
+
+    // Release everything allocated so far, keeping the blocks for reuse
+    void Reset() {
+        block_ = 0;
+        offset_ = 0;
+        large_blocks_.clear();
+    }
+
+   private:
+    std::vector<std::unique_ptr<uint8_t[]>> blocks_;
+    std::vector<std::unique_ptr<uint8_t[]>> large_blocks_;
+    size_t block_ = 0;
+    size_t offset_ = 0;
+};
+
+// A dispatchable handle of the replay. The layer finds its data through the first pointer-sized word of a dispatchable
+// object, which the loader sets to its dispatch table, so the objects of an instance or device share that word.
+struct ReplayDispatchableObject {
+    void *dispatch_key;
+    uint64_t recorded_handle;
+};
+
+// What the validation objects query from a physical device when a device is created, as CapturePhysicalDeviceState records it
+struct ReplayPhysicalDeviceState {
+    VkPhysicalDeviceProperties properties = {};
+    VkPhysicalDeviceFeatures features = {};
+    VkPhysicalDeviceMemoryProperties memory_properties = {};
+    std::vector<VkQueueFamilyProperties> queue_families;
+    std::vector<VkFormatProperties> format_properties;
+    // Extension property structures, decoded into the state arena of the replay
+    const void *extension_properties = nullptr;
+};
+
+// State of the replay of one capture file. A capture is replayed on a single thread, which the stubs find it through, so the
+// validation objects must not move their checks to other threads; see ReplayPrepareSettings.
+class ReplayContext {
+   public:
+    static const uint32_t kNoCommand = UINT32_MAX;
+
+    explicit ReplayContext(const std::string &name) : name_(name) {}
+
+    const std::string &name() const { return name_; }
+
+    static ReplayContext *Current() { return current_; }
+    static void SetCurrent(ReplayContext *context) { current_ = context; }
+
+    // Arena for the parameters of the record being replayed, and for state that lasts as long as the replay
+    ReplayArena &record_arena() { return record_arena_; }
+    ReplayArena &state_arena() { return state_arena_; }
+
+    void BeginRecord() {
+        record_arena_.Reset();
+        parent_key_ = nullptr;
+    }
+
+    // The replay object of a recorded dispatchable handle, created when the handle is first seen. Instances and devices get
+    // dispatch keys of their own; other objects share the key of the first dispatchable parameter of the call that returns
+    // them, which is their parent.
+    void *DispatchableObject(uint64_t recorded_handle, bool root) {
+        if (recorded_handle == 0) return nullptr;
+        auto &object = dispatchable_objects_[recorded_handle];
+        if (!object) {
+            object.reset(new ReplayDispatchableObject{nullptr, recorded_handle});
+            object->dispatch_key = (root || !parent_key_) ? object.get() : parent_key_;
+        }
+        if (!parent_key_) parent_key_ = object->dispatch_key;
+        return object.get();
+    }
+
+    static uint64_t RecordedHandle(const void *dispatchable) {
+        return dispatchable ? static_cast<const ReplayDispatchableObject *>(dispatchable)->recorded_handle : 0;
+    }
+
+    // Mark the command whose intercept is about to be called, and the result the driver returned for it in the capture
+    void BeginCall(uint32_t command) { command_ = command; }
+    template <typename T>
+    void BeginCall(uint32_t command, const T &result) {
+        static_assert(sizeof(T) <= sizeof(result_), "Command result does not fit");
+        command_ = command;
+        memcpy(result_, &result, sizeof(T));
+    }
+    void EndCall() { command_ = kNoCommand; }
+    uint32_t command() const { return command_; }
+
+    // The recorded result if the stub of the command being replayed asks for it, or zero for calls that the validation objects
+    // make on their own
+    template <typename T>
+    T Result(uint32_t command) const {
+        T result = T();
+        if (command == command_) memcpy(&result, result_, sizeof(T));
+        return result;
+    }
+
+    ReplayPhysicalDeviceState &AddPhysicalDeviceState(uint64_t recorded_handle) { return physical_device_states_[recorded_handle]; }
+    const ReplayPhysicalDeviceState *PhysicalDeviceState(VkPhysicalDevice physical_device) const {
+        auto it = physical_device_states_.find(RecordedHandle(physical_device));
+        return it == physical_device_states_.end() ? nullptr : &it->second;
+    }
+
+    // Host memory standing in for the device memory that the application maps. The memory of each allocation is kept from
+    // one map to the next, so that an application mapping the same allocation every frame does not allocate on every replayed
+    // map; it only grows when a map needs more.
+    void AllocateMemory(uint64_t memory, VkDeviceSize size) { memory_sizes_[memory] = size; }
+    void *MapMemory(uint64_t memory, VkDeviceSize offset, VkDeviceSize size) {
+        if (size == VK_WHOLE_SIZE) {
+            const VkDeviceSize allocation_size = memory_sizes_[memory];
+            size = allocation_size > offset ? allocation_size - offset : 0;
+        }
+        auto &mapping = memory_mappings_[memory];
+        const size_t mapping_size = static_cast<size_t>(size ? size : 1);
+        if (mapping.size() < mapping_size) mapping.resize(mapping_size);
+        return mapping.data();
+    }
+    void FreeMemory(uint64_t memory) {
+        memory_sizes_.erase(memory);
+        memory_mappings_.erase(memory);
+    }
+
+    void CountMessage(VkDebugUtilsMessageSeverityFlagBitsEXT severity) {
+        if (severity & VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT) ++error_count_;
+        if (severity & VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT) ++warning_count_;
+    }
+    uint64_t error_count() const { return error_count_.load(); }
+    uint64_t warning_count() const { return warning_count_.load(); }
+
+   private:
+    static thread_local ReplayContext *current_;
+
+    std::string name_;
+    ReplayArena record_arena_;
+    ReplayArena state_arena_;
+    std::unordered_map<uint64_t, std::unique_ptr<ReplayDispatchableObject>> dispatchable_objects_;
+    void *parent_key_ = nullptr;
+    uint32_t command_ = kNoCommand;
+    uint8_t result_[sizeof(uint64_t)] = {};
+    std::unordered_map<uint64_t, ReplayPhysicalDeviceState> physical_device_states_;
+    std::unordered_map<uint64_t, VkDeviceSize> memory_sizes_;
+    std::unordered_map<uint64_t, std::vector<uint8_t>> memory_mappings_;
+    // Messages may be reported from threads other than the one replaying the capture
+    std::atomic<uint64_t> error_count_{0};
+    std::atomic<uint64_t> warning_count_{0};
+};
+
+// Reads back the payload of a call record, the reverse of ApiCaptureEncoder. Pointers are set to copies in an arena. Reading
+// past the end of the payload, or a count that the payload cannot hold, fails the record, which is then not replayed.
+class ApiCaptureDecoder {
+   public:
+    ApiCaptureDecoder(ReplayContext &context, ReplayArena &arena, const uint8_t *data, size_t size)
+        : context_(context), arena_(arena), data_(data), size_(size) {}
+
+    // True once the whole payload has been read without error
+    bool Finished() const { return !failed_ && offset_ == size_; }
+    void Fail() { failed_ = true; }
+
+    void Bytes(void *bytes, size_t size) {
+        if (failed_ || size > size_ - offset_) {
+            failed_ = true;
+            memset(bytes, 0, size);
+            return;
+        }
+        if (size) memcpy(bytes, data_ + offset_, size);
+        offset_ += size;
+    }
+
+    template <typename T>
+    void Value(T &value) {
+        Bytes(&value, sizeof(T));
+    }
+
+    template <typename T>
+    T Read() {
+        T value;
+        Value(value);
+        return value;
+    }
+
+    template <typename T>
+    void Handle(T &handle) {
+        handle = CastFromUint64<T>(Read<uint64_t>());
+    }
+
+    template <typename T>
+    void Dispatchable(T &handle) {
+        const bool root = std::is_same<T, VkInstance>::value || std::is_same<T, VkDevice>::value;
+        handle = static_cast<T>(context_.DispatchableObject(Read<uint64_t>(), root));
+    }
+
+    // Addresses in the captured process, such as pUserData, which are passed on but never followed
+    template <typename T>
+    void Address(T &pointer) {
+        pointer = reinterpret_cast<T>(static_cast<uintptr_t>(Read<uint64_t>()));
+    }
+
+    bool Pointer() { return Read<uint8_t>() != 0; }
+
+    uint64_t Count() {
+        const uint64_t count = Read<uint64_t>();
+        if (count > size_ - offset_) {
+            failed_ = true;
+            return 0;
+        }
+        return count;
+    }
+
+    const char *String() {
+        const uint32_t length = Read<uint32_t>();
+        if (length == 0) return nullptr;
+        if (length - 1 > size_ - offset_) {
+            failed_ = true;
+            return "";
+        }
+        char *string = Allocate<char>(length);
+        Bytes(string, length - 1);
+        return string;
+    }
+
+    // An array written by ApiCaptureEncoder::Array, returning its element count
+    template <typename P>
+    uint64_t Array(P &pointer) {
+        typedef typename std::remove_cv<typename std::remove_pointer<P>::type>::type T;
+        pointer = nullptr;
+        if (!Pointer()) return 0;
+        const uint64_t count = Count();
+        T *values = Allocate<T>(count);
+        Bytes(values, static_cast<size_t>(sizeof(T) * count));
+        pointer = values;
+        return count;
+    }
+
+    template <typename P>
+    void Blob(P &pointer) {
+        const uint8_t *bytes = nullptr;
+        Array(bytes);
+        pointer = const_cast<uint8_t *>(bytes);
+    }
+
+    template <typename T>
+    T *Allocate(uint64_t count) {
+        return static_cast<T *>(arena_.Allocate(static_cast<size_t>(sizeof(T) * count)));
+    }
+
+    // The type of the structure that starts at the read position, if any, without reading it
+    VkStructureType PeekStructureType() const {
+        VkStructureType type = VK_STRUCTURE_TYPE_MAX_ENUM;
+        if (!failed_ && size_ - offset_ >= sizeof(type)) memcpy(&type, data_ + offset_, sizeof(type));
+        return type;
+    }
+
+   private:
+    ReplayContext &context_;
+    ReplayArena &arena_;
+    const uint8_t *data_;
+    size_t size_;
+    size_t offset_ = 0;
+    bool failed_ = false;
+};
+
+typedef bool (*ReplayFunction)(ReplayContext &context, ApiCaptureDecoder &decoder);
+
+// The result a stub returns, as recorded for the call being replayed
+template <typename T>
+T StubResult(uint32_t command) {
+    const ReplayContext *context = ReplayContext::Current();
+    return context ? context->Result<T>(command) : T();
+}
+
+struct ReplaySummary {
+    std::string error;
+    uint64_t replayed = 0;
+    uint64_t skipped = 0;
+    uint64_t malformed = 0;
+    bool truncated = false;
+};
+
+// Read the vk_layer_settings.txt config file and override the settings that cannot work in a replay. Deferred validation is
+// turned off, since the stubs that answer the queries of the validation objects only find the replay on its own thread. Call
+// this before any capture is replayed.
+void ReplayPrepareSettings();
+
+// Replays one capture file on the calling thread, counting the messages reported into the context
+ReplaySummary ReplayCapture(ReplayContext &context);
+
+// Replays the capture file of each context, up to jobs of them at a time, each on a thread of its own. The contexts must outlive
+// the replay: the layer keys its state by the addresses of their dispatchable objects.
+std::vector<ReplaySummary> ReplayCaptures(const std::vector<std::unique_ptr<ReplayContext>> &contexts, uint32_t jobs);
+
+// Generated in chassis_replay.cpp
+void *CaptureDecodePNext(ApiCaptureDecoder &decoder);
+size_t CaptureStructureSize(VkStructureType type);
+extern const ReplayFunction replay_functions[];
+extern const std::unordered_map<std::string, PFN_vkVoidFunction> replay_stub_functions;
+
+}  // namespace vulkan_layer_replay
+
+#endif  // VK_LAYER_REPLAY_H
@@ -0,0 +1,87 @@
+/* Copyright (c) 2019 The Khronos Group Inc.
+ * Copyright (c) 2019 Valve Corporation
+ * Copyright (c) 2019 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// vk_layer_replay: validates API captures offline, without a Vulkan driver or GPU.
+//
+//     vk_layer_replay [--jobs N] capture...
+//
+// Each capture file is replayed through the validation objects on a thread of its own, with up to N captures replayed at a
+// time. Messages are reported as the vk_layer_settings.txt config file of the replay machine asks, and counted per capture.
+// The exit code is nonzero if a capture could not be read or if any capture reported an error.
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "vk_layer_replay.h"
+
+using namespace vulkan_layer_replay;
+
+static void PrintUsage() { fprintf(stderr, "usage: vk_layer_replay [--jobs N] capture...\n"); }
+
+int main(int argc, char **argv) {
+    uint32_t jobs = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<std::string> paths;
+    for (int arg = 1; arg < argc; ++arg) {
+        const std::string option = argv[arg];
+        if (option == "--jobs" && arg + 1 < argc) {
+            jobs = static_cast<uint32_t>(std::max(1, atoi(argv[++arg])));
+        } else if (option == "--help" || option == "-h") {
+            PrintUsage();
+            return 0;
+        } else if (option.size() > 1 && option[0] == '-') {
+            PrintUsage();
+            return 2;
+        } else {
+            paths.push_back(option);
+        }
+    }
+    if (paths.empty()) {
+        PrintUsage();
+        return 2;
+    }
+
+    // Read the settings file before the workers start
+    ReplayPrepareSettings();
+
+    std::vector<std::unique_ptr<ReplayContext>> contexts;
+    for (const auto &path : paths) contexts.emplace_back(new ReplayContext(path));
+    const std::vector<ReplaySummary> summaries = ReplayCaptures(contexts, jobs);
+
+    int exit_code = 0;
+    for (size_t index = 0; index < contexts.size(); ++index) {
+        const ReplayContext &context = *contexts[index];
+        const ReplaySummary &summary = summaries[index];
+        if (!summary.error.empty()) {
+            fprintf(stdout, "%s: %s\n", context.name().c_str(), summary.error.c_str());
+            exit_code = 1;
+            continue;
+        }
+        fprintf(stdout, "%s: %llu calls replayed, %llu skipped, %llu malformed%s; %llu errors, %llu warnings\n",
+                context.name().c_str(), static_cast<unsigned long long>(summary.replayed),
+                static_cast<unsigned long long>(summary.skipped), static_cast<unsigned long long>(summary.malformed),
+                summary.truncated ? ", truncated" : "", static_cast<unsigned long long>(context.error_count()),
+                static_cast<unsigned long long>(context.warning_count()));
+        if (context.error_count()) exit_code = 1;
+    }
+    // The contexts outlive the replay: the layer keys its state by the addresses of their dispatchable objects
+    return exit_code;
+}
@@ -19,10 +19,16 @@
  *
  */
 
+#include <stdlib.h>
 #include <string.h>
+#include <sstream>
 #include <string>
 #include <vector>
 #include <map>
+#ifdef WIN32
+#include <fcntl.h>
+#include <io.h>
+#endif
 #include "vulkan/vulkan.h"
 #include "vk_layer_config.h"
 #include "vk_layer_utils.h"
@@ -76,6 +82,48 @@ VK_LAYER_EXPORT VkStringErrorFlags vk_string_validate(const int max_length, cons
 // Utility function for determining if a string is in a set of strings
 VK_LAYER_EXPORT bool white_list(const char *item, const std::set<std::string> &list) { return (list.find(item) != list.end()); }
 
+// Mute the comma-separated message IDs listed in the message_id_filter setting
+static void layer_debug_filter_message_ids(debug_report_data *report_data, const char *layer_identifier) {
+    std::string message_id_filter_key = layer_identifier;
+    message_id_filter_key.append(".message_id_filter");
+    std::istringstream message_ids(getLayerOption(message_id_filter_key.c_str()));
+    std::string message_id;
+    while (std::getline(message_ids, message_id, ',')) {
+        const auto first = message_id.find_first_not_of(" \t");
+        if (first == std::string::npos) continue;
+        const auto last = message_id.find_last_not_of(" \t");
+        report_data->FilterMessageId(message_id.substr(first, last - first + 1));
+    }
+}
+
+// Limit how many times the same message is reported for the same object, per the duplicate_message_limit setting
+static void layer_debug_limit_duplicate_messages(debug_report_data *report_data, const char *layer_identifier) {
+    std::string duplicate_message_limit_key = layer_identifier;
+    duplicate_message_limit_key.append(".duplicate_message_limit");
+    const char *duplicate_message_limit = getLayerOption(duplicate_message_limit_key.c_str());
+    if (!duplicate_message_limit || !*duplicate_message_limit || report_data->duplicate_messages) return;
+    uint32_t limit = static_cast<uint32_t>(strtoul(duplicate_message_limit, nullptr, 10));
+    if (limit) report_data->duplicate_messages.reset(new DuplicateMessageCounter(limit));
+}
+
+// Whether the log_async setting asks for log_filename output to be written on a background thread
+static bool layer_debug_log_async(const char *layer_identifier) {
+    std::string log_async_key = layer_identifier;
+    log_async_key.append(".log_async");
+    const std::string log_async = getLayerOption(log_async_key.c_str());
+    return log_async == "true" || log_async == "1";
+}
+
+// Record format for log_filename output requested by the log_format setting
+static LogFormat layer_debug_log_format(const char *layer_identifier) {
+    std::string log_format_key = layer_identifier;
+    log_format_key.append(".log_format");
+    const std::string log_format = getLayerOption(log_format_key.c_str());
+    if (log_format == "jsonl") return kLogFormatJsonLines;
+    if (log_format == "binary") return kLogFormatBinary;
+    return kLogFormatText;
+}
+
 // Debug callbacks get created in three ways:
 //   o  Application-defined debug callbacks
 //   o  Through settings in a vk_layer_settings.txt file
@@ -99,6 +147,9 @@ VK_LAYER_EXPORT void layer_debug_messenger_actions(debug_report_data *report_dat
     debug_action_key.append(".debug_action");
     log_filename_key.append(".log_filename");
 
+    layer_debug_filter_message_ids(report_data, layer_identifier);
+    layer_debug_limit_duplicate_messages(report_data, layer_identifier);
+
     // Initialize layer options
     VkDebugReportFlagsEXT report_flags = GetLayerOptionFlags(report_flags_key, report_flags_option_definitions, 0);
     VkLayerDbgActionFlags debug_action = GetLayerOptionFlags(debug_action_key, debug_actions_option_definitions, 0);
@@ -130,6 +181,26 @@ VK_LAYER_EXPORT void layer_debug_messenger_actions(debug_report_data *report_dat
         FILE *log_output = getLayerLogOutput(log_filename, layer_identifier);
         dbgCreateInfo.pfnUserCallback = messenger_log_callback;
         dbgCreateInfo.pUserData = (void *)log_output;
+        AsyncLogSink *async_sink = nullptr;
+        if (layer_debug_log_async(layer_identifier)) {
+            report_data->async_log_sinks.emplace_back(new AsyncLogSink(log_output));
+            async_sink = report_data->async_log_sinks.back().get();
+            dbgCreateInfo.pfnUserCallback = messenger_async_log_callback;
+            dbgCreateInfo.pUserData = (void *)async_sink;
+        }
+        LogFormat log_format = layer_debug_log_format(layer_identifier);
+        if (log_format != kLogFormatText) {
+            if (log_format == kLogFormatBinary) {
+#ifdef WIN32
+                _setmode(_fileno(log_output), _O_BINARY);
+#endif
+                const std::string header = BinaryLogHeader();
+                fwrite(header.data(), 1, header.size(), log_output);
+            }
+            report_data->structured_log_outputs.emplace_back(new StructuredLogOutput{log_format, log_output, async_sink});
+            dbgCreateInfo.pfnUserCallback = messenger_structured_log_callback;
+            dbgCreateInfo.pUserData = (void *)report_data->structured_log_outputs.back().get();
+        }
         layer_create_messenger_callback(report_data, default_layer_callback, &dbgCreateInfo, pAllocator, &messenger);
         logging_messenger.push_back(messenger);
     }
@@ -158,6 +229,9 @@ VK_LAYER_EXPORT void layer_debug_report_actions(debug_report_data *report_data,
     debug_action_key.append(".debug_action");
     log_filename_key.append(".log_filename");
 
+    layer_debug_filter_message_ids(report_data, layer_identifier);
+    layer_debug_limit_duplicate_messages(report_data, layer_identifier);
+
     // Initialize layer options
     VkDebugReportFlagsEXT report_flags = GetLayerOptionFlags(report_flags_key, report_flags_option_definitions, 0);
     VkLayerDbgActionFlags debug_action = GetLayerOptionFlags(debug_action_key, debug_actions_option_definitions, 0);
@@ -173,6 +247,11 @@ VK_LAYER_EXPORT void layer_debug_report_actions(debug_report_data *report_data,
         dbgCreateInfo.flags = report_flags;
         dbgCreateInfo.pfnCallback = report_log_callback;
         dbgCreateInfo.pUserData = (void *)log_output;
+        if (layer_debug_log_async(layer_identifier)) {
+            report_data->async_log_sinks.emplace_back(new AsyncLogSink(log_output));
+            dbgCreateInfo.pfnCallback = report_async_log_callback;
+            dbgCreateInfo.pUserData = (void *)report_data->async_log_sinks.back().get();
+        }
         layer_create_report_callback(report_data, default_layer_callback, &dbgCreateInfo, pAllocator, &callback);
         logging_callback.push_back(callback);
     }
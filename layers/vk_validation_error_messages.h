@@ -29,7 +29,7 @@
 // Disable auto-formatting for generated file
 // clang-format off
 
-// Mapping from VUID string to the corresponding spec text
+// Mapping from VUID string to the corresponding spec text, sorted by VUID string
 typedef struct _vuid_spec_text_pair {
     const char * vuid;
     const char * spec_text;
@@ -71,3 +71,19 @@ def GetFeatureProtect(interface):
     if platform is not None:
         protect = platform_dict[platform]
     return protect
+
+#
+# Return the device extension that must be enabled for vkGetDeviceProcAddr to return a command, or None. The dispatch table
+# helper generates ApiParentExtensionEnabled from this, and the layer chassis applies it to the commands it intercepts, so the
+# two cannot disagree.
+def GetDeviceCommandExtension(registry, feature_name, name, cmd_elem):
+    """Get the parent extension of a device-level extension command"""
+    if name in ['vkCreateInstance', 'vkCreateDevice', 'vkGetInstanceProcAddr'] or 'VK_VERSION' in feature_name:
+        return None
+    params = cmd_elem.findall('param')
+    handle_type = params[0].find('type').text if params else None
+    if handle_type is None or handle_type in ['VkInstance', 'VkPhysicalDevice']:
+        return None
+    if registry.tree.find("types/type/[name='" + handle_type + "'][@category='handle']") is None:
+        return None
+    return feature_name
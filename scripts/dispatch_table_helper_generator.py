@@ -177,8 +177,9 @@ class DispatchTableHelperOutputGenerator(OutputGenerator):
             promoted = not extension and "VK_VERSION_1_0" != self.featureName
             if promoted or extension:
                 self.device_stub_list.append([name, self.featureName])
-                if extension:
-                    self.device_extension_list.append([name, self.featureName])
+                parent_extension = GetDeviceCommandExtension(self.registry, self.featureName, name, cmdinfo.elem)
+                if parent_extension:
+                    self.device_extension_list.append([name, parent_extension])
                 # Build up stub function
                 return_type = ''
                 decl = self.makeCDecls(cmdinfo.elem)[1]
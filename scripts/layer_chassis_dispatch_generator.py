@@ -148,7 +148,6 @@ VkResult DispatchCreateComputePipelines(VkDevice device, VkPipelineCache pipelin
                                                                                           pCreateInfos, pAllocator, pPipelines);
     safe_VkComputePipelineCreateInfo *local_pCreateInfos = NULL;
     if (pCreateInfos) {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         local_pCreateInfos = new safe_VkComputePipelineCreateInfo[createInfoCount];
         for (uint32_t idx0 = 0; idx0 < createInfoCount; ++idx0) {
             local_pCreateInfos[idx0].initialize(&pCreateInfos[idx0]);
@@ -164,19 +163,15 @@ VkResult DispatchCreateComputePipelines(VkDevice device, VkPipelineCache pipelin
         }
     }
     if (pipelineCache) {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         pipelineCache = layer_data->Unwrap(pipelineCache);
     }
 
     VkResult result = layer_data->device_dispatch_table.CreateComputePipelines(device, pipelineCache, createInfoCount,
                                                                                local_pCreateInfos->ptr(), pAllocator, pPipelines);
     delete[] local_pCreateInfos;
-    {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
-        for (uint32_t i = 0; i < createInfoCount; ++i) {
-            if (pPipelines[i] != VK_NULL_HANDLE) {
-                pPipelines[i] = layer_data->WrapNew(pPipelines[i]);
-            }
+    for (uint32_t i = 0; i < createInfoCount; ++i) {
+        if (pPipelines[i] != VK_NULL_HANDLE) {
+            pPipelines[i] = layer_data->WrapNew(pPipelines[i]);
         }
     }
     return result;
@@ -227,19 +222,15 @@ VkResult DispatchCreateGraphicsPipelines(VkDevice device, VkPipelineCache pipeli
         }
     }
     if (pipelineCache) {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         pipelineCache = layer_data->Unwrap(pipelineCache);
     }
 
     VkResult result = layer_data->device_dispatch_table.CreateGraphicsPipelines(device, pipelineCache, createInfoCount,
                                                                                 local_pCreateInfos->ptr(), pAllocator, pPipelines);
     delete[] local_pCreateInfos;
-    {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
-        for (uint32_t i = 0; i < createInfoCount; ++i) {
-            if (pPipelines[i] != VK_NULL_HANDLE) {
-                pPipelines[i] = layer_data->WrapNew(pPipelines[i]);
-            }
+    for (uint32_t i = 0; i < createInfoCount; ++i) {
+        if (pPipelines[i] != VK_NULL_HANDLE) {
+            pPipelines[i] = layer_data->WrapNew(pPipelines[i]);
         }
     }
     return result;
@@ -293,14 +284,10 @@ VkResult DispatchCreateRenderPass2KHR(VkDevice device, const VkRenderPassCreateI
 void DispatchDestroyRenderPass(VkDevice device, VkRenderPass renderPass, const VkAllocationCallbacks *pAllocator) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.DestroyRenderPass(device, renderPass, pAllocator);
-    std::unique_lock<std::mutex> lock(dispatch_lock);
-    uint64_t renderPass_id = reinterpret_cast<uint64_t &>(renderPass);
-    renderPass = (VkRenderPass)unique_id_mapping[renderPass_id];
-    unique_id_mapping.erase(renderPass_id);
-    lock.unlock();
+    renderPass = (VkRenderPass)unique_id_mapping.Remove(reinterpret_cast<uint64_t &>(renderPass));
     layer_data->device_dispatch_table.DestroyRenderPass(device, renderPass, pAllocator);
 
-    lock.lock();
+    std::lock_guard<std::mutex> lock(dispatch_lock);
     layer_data->renderpasses_states.erase(renderPass);
 }
 
@@ -310,7 +297,6 @@ VkResult DispatchCreateSwapchainKHR(VkDevice device, const VkSwapchainCreateInfo
     if (!wrap_handles) return layer_data->device_dispatch_table.CreateSwapchainKHR(device, pCreateInfo, pAllocator, pSwapchain);
     safe_VkSwapchainCreateInfoKHR *local_pCreateInfo = NULL;
     if (pCreateInfo) {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         local_pCreateInfo = new safe_VkSwapchainCreateInfoKHR(pCreateInfo);
         local_pCreateInfo->oldSwapchain = layer_data->Unwrap(pCreateInfo->oldSwapchain);
         // Surface is instance-level object
@@ -321,7 +307,6 @@ VkResult DispatchCreateSwapchainKHR(VkDevice device, const VkSwapchainCreateInfo
     delete local_pCreateInfo;
 
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         *pSwapchain = layer_data->WrapNew(*pSwapchain);
     }
     return result;
@@ -334,19 +319,16 @@ VkResult DispatchCreateSharedSwapchainsKHR(VkDevice device, uint32_t swapchainCo
         return layer_data->device_dispatch_table.CreateSharedSwapchainsKHR(device, swapchainCount, pCreateInfos, pAllocator,
                                                                            pSwapchains);
     safe_VkSwapchainCreateInfoKHR *local_pCreateInfos = NULL;
-    {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
-        if (pCreateInfos) {
-            local_pCreateInfos = new safe_VkSwapchainCreateInfoKHR[swapchainCount];
-            for (uint32_t i = 0; i < swapchainCount; ++i) {
-                local_pCreateInfos[i].initialize(&pCreateInfos[i]);
-                if (pCreateInfos[i].surface) {
-                    // Surface is instance-level object
-                    local_pCreateInfos[i].surface = layer_data->Unwrap(pCreateInfos[i].surface);
-                }
-                if (pCreateInfos[i].oldSwapchain) {
-                    local_pCreateInfos[i].oldSwapchain = layer_data->Unwrap(pCreateInfos[i].oldSwapchain);
-                }
+    if (pCreateInfos) {
+        local_pCreateInfos = new safe_VkSwapchainCreateInfoKHR[swapchainCount];
+        for (uint32_t i = 0; i < swapchainCount; ++i) {
+            local_pCreateInfos[i].initialize(&pCreateInfos[i]);
+            if (pCreateInfos[i].surface) {
+                // Surface is instance-level object
+                local_pCreateInfos[i].surface = layer_data->Unwrap(pCreateInfos[i].surface);
+            }
+            if (pCreateInfos[i].oldSwapchain) {
+                local_pCreateInfos[i].oldSwapchain = layer_data->Unwrap(pCreateInfos[i].oldSwapchain);
             }
         }
     }
@@ -354,7 +336,6 @@ VkResult DispatchCreateSharedSwapchainsKHR(VkDevice device, uint32_t swapchainCo
                                                                                   pAllocator, pSwapchains);
     delete[] local_pCreateInfos;
     if (VK_SUCCESS == result) {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         for (uint32_t i = 0; i < swapchainCount; i++) {
             pSwapchains[i] = layer_data->WrapNew(pSwapchains[i]);
         }
@@ -369,7 +350,6 @@ VkResult DispatchGetSwapchainImagesKHR(VkDevice device, VkSwapchainKHR swapchain
         return layer_data->device_dispatch_table.GetSwapchainImagesKHR(device, swapchain, pSwapchainImageCount, pSwapchainImages);
     VkSwapchainKHR wrapped_swapchain_handle = swapchain;
     if (VK_NULL_HANDLE != swapchain) {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         swapchain = layer_data->Unwrap(swapchain);
     }
     VkResult result =
@@ -396,13 +376,11 @@ void DispatchDestroySwapchainKHR(VkDevice device, VkSwapchainKHR swapchain, cons
 
     auto &image_array = layer_data->swapchain_wrapped_image_handle_map[swapchain];
     for (auto &image_handle : image_array) {
-        unique_id_mapping.erase(HandleToUint64(image_handle));
+        unique_id_mapping.Remove(HandleToUint64(image_handle));
     }
     layer_data->swapchain_wrapped_image_handle_map.erase(swapchain);
 
-    uint64_t swapchain_id = HandleToUint64(swapchain);
-    swapchain = (VkSwapchainKHR)unique_id_mapping[swapchain_id];
-    unique_id_mapping.erase(swapchain_id);
+    swapchain = (VkSwapchainKHR)unique_id_mapping.Remove(HandleToUint64(swapchain));
     lock.unlock();
     layer_data->device_dispatch_table.DestroySwapchainKHR(device, swapchain, pAllocator);
 }
@@ -411,19 +389,16 @@ VkResult DispatchQueuePresentKHR(VkQueue queue, const VkPresentInfoKHR *pPresent
     auto layer_data = GetLayerDataPtr(get_dispatch_key(queue), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.QueuePresentKHR(queue, pPresentInfo);
     safe_VkPresentInfoKHR *local_pPresentInfo = NULL;
-    {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
-        if (pPresentInfo) {
-            local_pPresentInfo = new safe_VkPresentInfoKHR(pPresentInfo);
-            if (local_pPresentInfo->pWaitSemaphores) {
-                for (uint32_t index1 = 0; index1 < local_pPresentInfo->waitSemaphoreCount; ++index1) {
-                    local_pPresentInfo->pWaitSemaphores[index1] = layer_data->Unwrap(pPresentInfo->pWaitSemaphores[index1]);
-                }
+    if (pPresentInfo) {
+        local_pPresentInfo = new safe_VkPresentInfoKHR(pPresentInfo);
+        if (local_pPresentInfo->pWaitSemaphores) {
+            for (uint32_t index1 = 0; index1 < local_pPresentInfo->waitSemaphoreCount; ++index1) {
+                local_pPresentInfo->pWaitSemaphores[index1] = layer_data->Unwrap(pPresentInfo->pWaitSemaphores[index1]);
             }
-            if (local_pPresentInfo->pSwapchains) {
-                for (uint32_t index1 = 0; index1 < local_pPresentInfo->swapchainCount; ++index1) {
-                    local_pPresentInfo->pSwapchains[index1] = layer_data->Unwrap(pPresentInfo->pSwapchains[index1]);
-                }
+        }
+        if (local_pPresentInfo->pSwapchains) {
+            for (uint32_t index1 = 0; index1 < local_pPresentInfo->swapchainCount; ++index1) {
+                local_pPresentInfo->pSwapchains[index1] = layer_data->Unwrap(pPresentInfo->pSwapchains[index1]);
             }
         }
     }
@@ -447,13 +422,11 @@ void DispatchDestroyDescriptorPool(VkDevice device, VkDescriptorPool descriptorP
 
     // remove references to implicitly freed descriptor sets
     for(auto descriptor_set : layer_data->pool_descriptor_sets_map[descriptorPool]) {
-        unique_id_mapping.erase(reinterpret_cast<uint64_t &>(descriptor_set));
+        unique_id_mapping.Remove(reinterpret_cast<uint64_t &>(descriptor_set));
     }
     layer_data->pool_descriptor_sets_map.erase(descriptorPool);
 
-    uint64_t descriptorPool_id = reinterpret_cast<uint64_t &>(descriptorPool);
-    descriptorPool = (VkDescriptorPool)unique_id_mapping[descriptorPool_id];
-    unique_id_mapping.erase(descriptorPool_id);
+    descriptorPool = (VkDescriptorPool)unique_id_mapping.Remove(reinterpret_cast<uint64_t &>(descriptorPool));
     lock.unlock();
     layer_data->device_dispatch_table.DestroyDescriptorPool(device, descriptorPool, pAllocator);
 }
@@ -461,17 +434,13 @@ void DispatchDestroyDescriptorPool(VkDevice device, VkDescriptorPool descriptorP
 VkResult DispatchResetDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool, VkDescriptorPoolResetFlags flags) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.ResetDescriptorPool(device, descriptorPool, flags);
-    VkDescriptorPool local_descriptor_pool = VK_NULL_HANDLE;
-    {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
-        local_descriptor_pool = layer_data->Unwrap(descriptorPool);
-    }
+    VkDescriptorPool local_descriptor_pool = layer_data->Unwrap(descriptorPool);
     VkResult result = layer_data->device_dispatch_table.ResetDescriptorPool(device, local_descriptor_pool, flags);
     if (VK_SUCCESS == result) {
         std::lock_guard<std::mutex> lock(dispatch_lock);
         // remove references to implicitly freed descriptor sets
         for(auto descriptor_set : layer_data->pool_descriptor_sets_map[descriptorPool]) {
-            unique_id_mapping.erase(reinterpret_cast<uint64_t &>(descriptor_set));
+            unique_id_mapping.Remove(reinterpret_cast<uint64_t &>(descriptor_set));
         }
         layer_data->pool_descriptor_sets_map[descriptorPool].clear();
     }
@@ -484,17 +453,14 @@ VkResult DispatchAllocateDescriptorSets(VkDevice device, const VkDescriptorSetAl
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.AllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets);
     safe_VkDescriptorSetAllocateInfo *local_pAllocateInfo = NULL;
-    {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
-        if (pAllocateInfo) {
-            local_pAllocateInfo = new safe_VkDescriptorSetAllocateInfo(pAllocateInfo);
-            if (pAllocateInfo->descriptorPool) {
-                local_pAllocateInfo->descriptorPool = layer_data->Unwrap(pAllocateInfo->descriptorPool);
-            }
-            if (local_pAllocateInfo->pSetLayouts) {
-                for (uint32_t index1 = 0; index1 < local_pAllocateInfo->descriptorSetCount; ++index1) {
-                    local_pAllocateInfo->pSetLayouts[index1] = layer_data->Unwrap(local_pAllocateInfo->pSetLayouts[index1]);
-                }
+    if (pAllocateInfo) {
+        local_pAllocateInfo = new safe_VkDescriptorSetAllocateInfo(pAllocateInfo);
+        if (pAllocateInfo->descriptorPool) {
+            local_pAllocateInfo->descriptorPool = layer_data->Unwrap(pAllocateInfo->descriptorPool);
+        }
+        if (local_pAllocateInfo->pSetLayouts) {
+            for (uint32_t index1 = 0; index1 < local_pAllocateInfo->descriptorSetCount; ++index1) {
+                local_pAllocateInfo->pSetLayouts[index1] = layer_data->Unwrap(local_pAllocateInfo->pSetLayouts[index1]);
             }
         }
     }
@@ -520,15 +486,11 @@ VkResult DispatchFreeDescriptorSets(VkDevice device, VkDescriptorPool descriptor
     if (!wrap_handles)
         return layer_data->device_dispatch_table.FreeDescriptorSets(device, descriptorPool, descriptorSetCount, pDescriptorSets);
     VkDescriptorSet *local_pDescriptorSets = NULL;
-    VkDescriptorPool local_descriptor_pool = VK_NULL_HANDLE;
-    {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
-        local_descriptor_pool = layer_data->Unwrap(descriptorPool);
-        if (pDescriptorSets) {
-            local_pDescriptorSets = new VkDescriptorSet[descriptorSetCount];
-            for (uint32_t index0 = 0; index0 < descriptorSetCount; ++index0) {
-                local_pDescriptorSets[index0] = layer_data->Unwrap(pDescriptorSets[index0]);
-            }
+    VkDescriptorPool local_descriptor_pool = layer_data->Unwrap(descriptorPool);
+    if (pDescriptorSets) {
+        local_pDescriptorSets = new VkDescriptorSet[descriptorSetCount];
+        for (uint32_t index0 = 0; index0 < descriptorSetCount; ++index0) {
+            local_pDescriptorSets[index0] = layer_data->Unwrap(pDescriptorSets[index0]);
         }
     }
     VkResult result = layer_data->device_dispatch_table.FreeDescriptorSets(device, local_descriptor_pool, descriptorSetCount,
@@ -540,13 +502,81 @@ VkResult DispatchFreeDescriptorSets(VkDevice device, VkDescriptorPool descriptor
         for (uint32_t index0 = 0; index0 < descriptorSetCount; index0++) {
             VkDescriptorSet handle = pDescriptorSets[index0];
             pool_descriptor_sets.erase(handle);
-            uint64_t unique_id = reinterpret_cast<uint64_t &>(handle);
-            unique_id_mapping.erase(unique_id);
+            unique_id_mapping.Remove(reinterpret_cast<uint64_t &>(handle));
         }
     }
     return result;
 }
 
+// Record where each descriptor of a template's pData lives and what it holds
+static void BuildTemplateUnwrapEntries(TEMPLATE_STATE *template_state) {
+    auto const &create_info = template_state->create_info;
+    size_t allocation_size = 0;
+    for (uint32_t i = 0; i < create_info.descriptorUpdateEntryCount; i++) {
+        const auto &update_entry = create_info.pDescriptorUpdateEntries[i];
+        if (update_entry.descriptorType == VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT) {
+            // descriptorCount is the size of the block in bytes
+            template_state->unwrap_entries.push_back({update_entry.offset, kVulkanObjectTypeUnknown, update_entry.descriptorCount});
+            allocation_size = std::max(allocation_size, update_entry.offset + update_entry.descriptorCount);
+            continue;
+        }
+        VulkanObjectType type = kVulkanObjectTypeUnknown;
+        size_t size = 0;
+        switch (update_entry.descriptorType) {
+            case VK_DESCRIPTOR_TYPE_SAMPLER:
+            case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+            case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+            case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+            case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+                type = kVulkanObjectTypeImage;
+                size = sizeof(VkDescriptorImageInfo);
+                break;
+            case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+            case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+            case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+            case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
+                type = kVulkanObjectTypeBuffer;
+                size = sizeof(VkDescriptorBufferInfo);
+                break;
+            case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+            case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+                type = kVulkanObjectTypeBufferView;
+                size = sizeof(VkBufferView);
+                break;
+            case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_NV:
+                type = kVulkanObjectTypeAccelerationStructureNV;
+                size = sizeof(VkAccelerationStructureNV);
+                break;
+            default:
+                assert(0);
+                continue;
+        }
+        for (uint32_t j = 0; j < update_entry.descriptorCount; j++) {
+            size_t offset = update_entry.offset + j * update_entry.stride;
+            template_state->unwrap_entries.push_back({offset, type, size});
+            allocation_size = std::max(allocation_size, offset + size);
+        }
+    }
+    template_state->unwrapped_data_size = allocation_size;
+}
+
+// Per-thread buffers for the unwrapped copies of descriptor updates. They keep their capacity from call to call, so that
+// updates stop allocating once the buffers have grown to the application's largest update. Pointers into them are only valid
+// until the same thread's next descriptor update, so they must not be kept past the down-chain call they are passed to.
+struct DescriptorUpdateScratch {
+    std::vector<VkWriteDescriptorSet> writes;
+    std::vector<VkCopyDescriptorSet> copies;
+    std::vector<VkDescriptorImageInfo> image_infos;
+    std::vector<VkDescriptorBufferInfo> buffer_infos;
+    std::vector<VkBufferView> texel_buffer_views;
+    std::vector<uint64_t> template_data;
+};
+
+static DescriptorUpdateScratch &GetDescriptorUpdateScratch() {
+    static thread_local DescriptorUpdateScratch scratch;
+    return scratch;
+}
+
 // This is the core version of this routine.  The extension version is below.
 VkResult DispatchCreateDescriptorUpdateTemplate(VkDevice device, const VkDescriptorUpdateTemplateCreateInfoKHR *pCreateInfo,
                                                 const VkAllocationCallbacks *pAllocator,
@@ -556,16 +586,13 @@ VkResult DispatchCreateDescriptorUpdateTemplate(VkDevice device, const VkDescrip
         return layer_data->device_dispatch_table.CreateDescriptorUpdateTemplate(device, pCreateInfo, pAllocator,
                                                                                 pDescriptorUpdateTemplate);
     safe_VkDescriptorUpdateTemplateCreateInfo *local_create_info = NULL;
-    {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
-        if (pCreateInfo) {
-            local_create_info = new safe_VkDescriptorUpdateTemplateCreateInfo(pCreateInfo);
-            if (pCreateInfo->descriptorSetLayout) {
-                local_create_info->descriptorSetLayout = layer_data->Unwrap(pCreateInfo->descriptorSetLayout);
-            }
-            if (pCreateInfo->pipelineLayout) {
-                local_create_info->pipelineLayout = layer_data->Unwrap(pCreateInfo->pipelineLayout);
-            }
+    if (pCreateInfo) {
+        local_create_info = new safe_VkDescriptorUpdateTemplateCreateInfo(pCreateInfo);
+        if (pCreateInfo->descriptorSetLayout) {
+            local_create_info->descriptorSetLayout = layer_data->Unwrap(pCreateInfo->descriptorSetLayout);
+        }
+        if (pCreateInfo->pipelineLayout) {
+            local_create_info->pipelineLayout = layer_data->Unwrap(pCreateInfo->pipelineLayout);
         }
     }
     VkResult result = layer_data->device_dispatch_table.CreateDescriptorUpdateTemplate(device, local_create_info->ptr(), pAllocator,
@@ -576,6 +603,7 @@ VkResult DispatchCreateDescriptorUpdateTemplate(VkDevice device, const VkDescrip
 
         // Shadow template createInfo for later updates
         std::unique_ptr<TEMPLATE_STATE> template_state(new TEMPLATE_STATE(*pDescriptorUpdateTemplate, local_create_info));
+        BuildTemplateUnwrapEntries(template_state.get());
         layer_data->desc_template_map[(uint64_t)*pDescriptorUpdateTemplate] = std::move(template_state);
     }
     return result;
@@ -590,16 +618,13 @@ VkResult DispatchCreateDescriptorUpdateTemplateKHR(VkDevice device, const VkDesc
         return layer_data->device_dispatch_table.CreateDescriptorUpdateTemplateKHR(device, pCreateInfo, pAllocator,
                                                                                    pDescriptorUpdateTemplate);
     safe_VkDescriptorUpdateTemplateCreateInfo *local_create_info = NULL;
-    {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
-        if (pCreateInfo) {
-            local_create_info = new safe_VkDescriptorUpdateTemplateCreateInfo(pCreateInfo);
-            if (pCreateInfo->descriptorSetLayout) {
-                local_create_info->descriptorSetLayout = layer_data->Unwrap(pCreateInfo->descriptorSetLayout);
-            }
-            if (pCreateInfo->pipelineLayout) {
-                local_create_info->pipelineLayout = layer_data->Unwrap(pCreateInfo->pipelineLayout);
-            }
+    if (pCreateInfo) {
+        local_create_info = new safe_VkDescriptorUpdateTemplateCreateInfo(pCreateInfo);
+        if (pCreateInfo->descriptorSetLayout) {
+            local_create_info->descriptorSetLayout = layer_data->Unwrap(pCreateInfo->descriptorSetLayout);
+        }
+        if (pCreateInfo->pipelineLayout) {
+            local_create_info->pipelineLayout = layer_data->Unwrap(pCreateInfo->pipelineLayout);
         }
     }
     VkResult result = layer_data->device_dispatch_table.CreateDescriptorUpdateTemplateKHR(device, local_create_info->ptr(), pAllocator,
@@ -610,6 +635,7 @@ VkResult DispatchCreateDescriptorUpdateTemplateKHR(VkDevice device, const VkDesc
 
         // Shadow template createInfo for later updates
         std::unique_ptr<TEMPLATE_STATE> template_state(new TEMPLATE_STATE(*pDescriptorUpdateTemplate, local_create_info));
+        BuildTemplateUnwrapEntries(template_state.get());
         layer_data->desc_template_map[(uint64_t)*pDescriptorUpdateTemplate] = std::move(template_state);
     }
     return result;
@@ -624,8 +650,7 @@ void DispatchDestroyDescriptorUpdateTemplate(VkDevice device, VkDescriptorUpdate
     std::unique_lock<std::mutex> lock(dispatch_lock);
     uint64_t descriptor_update_template_id = reinterpret_cast<uint64_t &>(descriptorUpdateTemplate);
     layer_data->desc_template_map.erase(descriptor_update_template_id);
-    descriptorUpdateTemplate = (VkDescriptorUpdateTemplate)unique_id_mapping[descriptor_update_template_id];
-    unique_id_mapping.erase(descriptor_update_template_id);
+    descriptorUpdateTemplate = (VkDescriptorUpdateTemplate)unique_id_mapping.Remove(descriptor_update_template_id);
     lock.unlock();
     layer_data->device_dispatch_table.DestroyDescriptorUpdateTemplate(device, descriptorUpdateTemplate, pAllocator);
 }
@@ -639,109 +664,163 @@ void DispatchDestroyDescriptorUpdateTemplateKHR(VkDevice device, VkDescriptorUpd
     std::unique_lock<std::mutex> lock(dispatch_lock);
     uint64_t descriptor_update_template_id = reinterpret_cast<uint64_t &>(descriptorUpdateTemplate);
     layer_data->desc_template_map.erase(descriptor_update_template_id);
-    descriptorUpdateTemplate = (VkDescriptorUpdateTemplate)unique_id_mapping[descriptor_update_template_id];
-    unique_id_mapping.erase(descriptor_update_template_id);
+    descriptorUpdateTemplate = (VkDescriptorUpdateTemplate)unique_id_mapping.Remove(descriptor_update_template_id);
     lock.unlock();
     layer_data->device_dispatch_table.DestroyDescriptorUpdateTemplateKHR(device, descriptorUpdateTemplate, pAllocator);
 }
 
+// Copy pData with its handles unwrapped into the calling thread's scratch buffer. The result is valid until the thread's next
+// descriptor update. Must hold dispatch_lock, for desc_template_map.
 void *BuildUnwrappedUpdateTemplateBuffer(ValidationObject *layer_data, uint64_t descriptorUpdateTemplate, const void *pData) {
     auto const template_map_entry = layer_data->desc_template_map.find(descriptorUpdateTemplate);
     if (template_map_entry == layer_data->desc_template_map.end()) {
         assert(0);
+        return nullptr;
     }
-    auto const &create_info = template_map_entry->second->create_info;
-    size_t allocation_size = 0;
-    std::vector<std::tuple<size_t, VulkanObjectType, uint64_t, size_t>> template_entries;
+    const TEMPLATE_STATE *template_state = template_map_entry->second.get();
+    auto &template_data = GetDescriptorUpdateScratch().template_data;
+    template_data.resize((template_state->unwrapped_data_size + sizeof(uint64_t) - 1) / sizeof(uint64_t));
+    char *unwrapped_data = reinterpret_cast<char *>(template_data.data());
+
+    for (const auto &entry : template_state->unwrap_entries) {
+        const char *source = static_cast<const char *>(pData) + entry.offset;
+        char *destination = unwrapped_data + entry.offset;
+        switch (entry.type) {
+            case kVulkanObjectTypeImage: {
+                auto image_info = reinterpret_cast<const VkDescriptorImageInfo *>(source);
+                auto unwrapped_info = reinterpret_cast<VkDescriptorImageInfo *>(destination);
+                unwrapped_info->sampler = layer_data->Unwrap(image_info->sampler);
+                unwrapped_info->imageView = layer_data->Unwrap(image_info->imageView);
+                unwrapped_info->imageLayout = image_info->imageLayout;
+            } break;
+            case kVulkanObjectTypeBuffer: {
+                auto buffer_info = reinterpret_cast<const VkDescriptorBufferInfo *>(source);
+                auto unwrapped_info = reinterpret_cast<VkDescriptorBufferInfo *>(destination);
+                unwrapped_info->buffer = layer_data->Unwrap(buffer_info->buffer);
+                unwrapped_info->offset = buffer_info->offset;
+                unwrapped_info->range = buffer_info->range;
+            } break;
+            case kVulkanObjectTypeBufferView:
+                *reinterpret_cast<VkBufferView *>(destination) = layer_data->Unwrap(*reinterpret_cast<const VkBufferView *>(source));
+                break;
+            case kVulkanObjectTypeAccelerationStructureNV:
+                *reinterpret_cast<VkAccelerationStructureNV *>(destination) =
+                    layer_data->Unwrap(*reinterpret_cast<const VkAccelerationStructureNV *>(source));
+                break;
+            default:
+                // Plain data
+                memcpy(destination, source, entry.size);
+                break;
+        }
+    }
+    return unwrapped_data;
+}
 
-    for (uint32_t i = 0; i < create_info.descriptorUpdateEntryCount; i++) {
-        for (uint32_t j = 0; j < create_info.pDescriptorUpdateEntries[i].descriptorCount; j++) {
-            size_t offset = create_info.pDescriptorUpdateEntries[i].offset + j * create_info.pDescriptorUpdateEntries[i].stride;
-            char *update_entry = (char *)(pData) + offset;
-
-            switch (create_info.pDescriptorUpdateEntries[i].descriptorType) {
-                case VK_DESCRIPTOR_TYPE_SAMPLER:
-                case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
-                case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
-                case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
-                case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT: {
-                    auto image_entry = reinterpret_cast<VkDescriptorImageInfo *>(update_entry);
-                    allocation_size = std::max(allocation_size, offset + sizeof(VkDescriptorImageInfo));
-
-                    VkDescriptorImageInfo *wrapped_entry = new VkDescriptorImageInfo(*image_entry);
-                    wrapped_entry->sampler = layer_data->Unwrap(image_entry->sampler);
-                    wrapped_entry->imageView = layer_data->Unwrap(image_entry->imageView);
-                    template_entries.emplace_back(offset, kVulkanObjectTypeImage, CastToUint64(wrapped_entry), 0);
-                } break;
-
-                case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
-                case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
-                case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
-                case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC: {
-                    auto buffer_entry = reinterpret_cast<VkDescriptorBufferInfo *>(update_entry);
-                    allocation_size = std::max(allocation_size, offset + sizeof(VkDescriptorBufferInfo));
-
-                    VkDescriptorBufferInfo *wrapped_entry = new VkDescriptorBufferInfo(*buffer_entry);
-                    wrapped_entry->buffer = layer_data->Unwrap(buffer_entry->buffer);
-                    template_entries.emplace_back(offset, kVulkanObjectTypeBuffer, CastToUint64(wrapped_entry), 0);
-                } break;
-
-                case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
-                case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER: {
-                    auto buffer_view_handle = reinterpret_cast<VkBufferView *>(update_entry);
-                    allocation_size = std::max(allocation_size, offset + sizeof(VkBufferView));
-
-                    VkBufferView wrapped_entry = layer_data->Unwrap(*buffer_view_handle);
-                    template_entries.emplace_back(offset, kVulkanObjectTypeBufferView, CastToUint64(wrapped_entry), 0);
-                } break;
-                case VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT: {
-                    size_t numBytes = create_info.pDescriptorUpdateEntries[i].descriptorCount;
-                    allocation_size = std::max(allocation_size, offset + numBytes);
-                    // nothing to unwrap, just plain data
-                    template_entries.emplace_back(offset, kVulkanObjectTypeUnknown, CastToUint64(update_entry),
-                                                  numBytes);
-                    // to break out of the loop
-                    j = create_info.pDescriptorUpdateEntries[i].descriptorCount;
-                } break;
-                default:
-                    assert(0);
-                    break;
-            }
+enum DescriptorWriteArray { kDescriptorWriteNoArray, kDescriptorWriteImageInfo, kDescriptorWriteBufferInfo, kDescriptorWriteTexelBufferView };
+
+// The array of a VkWriteDescriptorSet that holds the descriptors of its type, if it has one
+static DescriptorWriteArray GetDescriptorWriteArray(const VkWriteDescriptorSet &write) {
+    switch (write.descriptorType) {
+        case VK_DESCRIPTOR_TYPE_SAMPLER:
+        case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+        case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+        case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+        case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+            return write.pImageInfo ? kDescriptorWriteImageInfo : kDescriptorWriteNoArray;
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
+            return write.pBufferInfo ? kDescriptorWriteBufferInfo : kDescriptorWriteNoArray;
+        case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+        case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+            return write.pTexelBufferView ? kDescriptorWriteTexelBufferView : kDescriptorWriteNoArray;
+        default:
+            return kDescriptorWriteNoArray;
+    }
+}
+
+void DispatchUpdateDescriptorSets(VkDevice device, uint32_t descriptorWriteCount, const VkWriteDescriptorSet *pDescriptorWrites,
+                                  uint32_t descriptorCopyCount, const VkCopyDescriptorSet *pDescriptorCopies) {
+    auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    if (!wrap_handles)
+        return layer_data->device_dispatch_table.UpdateDescriptorSets(device, descriptorWriteCount, pDescriptorWrites,
+                                                                      descriptorCopyCount, pDescriptorCopies);
+    auto &scratch = GetDescriptorUpdateScratch();
+
+    // Size the descriptor arrays before filling them, so that the writes can point into them
+    size_t image_info_count = 0;
+    size_t buffer_info_count = 0;
+    size_t texel_buffer_view_count = 0;
+    for (uint32_t i = 0; i < descriptorWriteCount; ++i) {
+        switch (GetDescriptorWriteArray(pDescriptorWrites[i])) {
+            case kDescriptorWriteImageInfo:
+                image_info_count += pDescriptorWrites[i].descriptorCount;
+                break;
+            case kDescriptorWriteBufferInfo:
+                buffer_info_count += pDescriptorWrites[i].descriptorCount;
+                break;
+            case kDescriptorWriteTexelBufferView:
+                texel_buffer_view_count += pDescriptorWrites[i].descriptorCount;
+                break;
+            default:
+                break;
         }
     }
-    // Allocate required buffer size and populate with source/unwrapped data
-    void *unwrapped_data = malloc(allocation_size);
-    for (auto &this_entry : template_entries) {
-        VulkanObjectType type = std::get<1>(this_entry);
-        void *destination = (char *)unwrapped_data + std::get<0>(this_entry);
-        uint64_t source = std::get<2>(this_entry);
-        size_t size = std::get<3>(this_entry);
-
-        if (size != 0) {
-            assert(type == kVulkanObjectTypeUnknown);
-            memcpy(destination, CastFromUint64<void *>(source), size);
-        } else {
-            switch (type) {
-                case kVulkanObjectTypeImage:
-                    *(reinterpret_cast<VkDescriptorImageInfo *>(destination)) =
-                        *(reinterpret_cast<VkDescriptorImageInfo *>(source));
-                    delete CastFromUint64<VkDescriptorImageInfo *>(source);
-                    break;
-                case kVulkanObjectTypeBuffer:
-                    *(reinterpret_cast<VkDescriptorBufferInfo *>(destination)) =
-                        *(CastFromUint64<VkDescriptorBufferInfo *>(source));
-                    delete CastFromUint64<VkDescriptorBufferInfo *>(source);
-                    break;
-                case kVulkanObjectTypeBufferView:
-                    *(reinterpret_cast<VkBufferView *>(destination)) = CastFromUint64<VkBufferView>(source);
-                    break;
-                default:
-                    assert(0);
-                    break;
-            }
+    scratch.image_infos.resize(image_info_count);
+    scratch.buffer_infos.resize(buffer_info_count);
+    scratch.texel_buffer_views.resize(texel_buffer_view_count);
+
+    VkDescriptorImageInfo *image_info = scratch.image_infos.data();
+    VkDescriptorBufferInfo *buffer_info = scratch.buffer_infos.data();
+    VkBufferView *texel_buffer_view = scratch.texel_buffer_views.data();
+    scratch.writes.assign(pDescriptorWrites, pDescriptorWrites + descriptorWriteCount);
+    for (auto &write : scratch.writes) {
+        write.dstSet = layer_data->Unwrap(write.dstSet);
+        // Extension structs are rare here; they take the allocating path
+        if (write.pNext) write.pNext = CreateUnwrappedExtensionStructs(layer_data, write.pNext);
+        switch (GetDescriptorWriteArray(write)) {
+            case kDescriptorWriteImageInfo:
+                for (uint32_t j = 0; j < write.descriptorCount; ++j) {
+                    image_info[j].sampler = layer_data->Unwrap(write.pImageInfo[j].sampler);
+                    image_info[j].imageView = layer_data->Unwrap(write.pImageInfo[j].imageView);
+                    image_info[j].imageLayout = write.pImageInfo[j].imageLayout;
+                }
+                write.pImageInfo = image_info;
+                image_info += write.descriptorCount;
+                break;
+            case kDescriptorWriteBufferInfo:
+                for (uint32_t j = 0; j < write.descriptorCount; ++j) {
+                    buffer_info[j].buffer = layer_data->Unwrap(write.pBufferInfo[j].buffer);
+                    buffer_info[j].offset = write.pBufferInfo[j].offset;
+                    buffer_info[j].range = write.pBufferInfo[j].range;
+                }
+                write.pBufferInfo = buffer_info;
+                buffer_info += write.descriptorCount;
+                break;
+            case kDescriptorWriteTexelBufferView:
+                for (uint32_t j = 0; j < write.descriptorCount; ++j) {
+                    texel_buffer_view[j] = layer_data->Unwrap(write.pTexelBufferView[j]);
+                }
+                write.pTexelBufferView = texel_buffer_view;
+                texel_buffer_view += write.descriptorCount;
+                break;
+            default:
+                break;
         }
     }
-    return (void *)unwrapped_data;
+
+    scratch.copies.assign(pDescriptorCopies, pDescriptorCopies + descriptorCopyCount);
+    for (auto &copy : scratch.copies) {
+        copy.srcSet = layer_data->Unwrap(copy.srcSet);
+        copy.dstSet = layer_data->Unwrap(copy.dstSet);
+    }
+
+    layer_data->device_dispatch_table.UpdateDescriptorSets(device, descriptorWriteCount, scratch.writes.data(), descriptorCopyCount,
+                                                           scratch.copies.data());
+    for (auto &write : scratch.writes) {
+        if (write.pNext) FreeUnwrappedExtensionStructs(const_cast<void *>(write.pNext));
+    }
 }
 
 void DispatchUpdateDescriptorSetWithTemplate(VkDevice device, VkDescriptorSet descriptorSet,
@@ -751,14 +830,15 @@ void DispatchUpdateDescriptorSetWithTemplate(VkDevice device, VkDescriptorSet de
         return layer_data->device_dispatch_table.UpdateDescriptorSetWithTemplate(device, descriptorSet, descriptorUpdateTemplate,
                                                                                  pData);
     uint64_t template_handle = reinterpret_cast<uint64_t &>(descriptorUpdateTemplate);
+    descriptorSet = layer_data->Unwrap(descriptorSet);
+    descriptorUpdateTemplate = layer_data->Unwrap(descriptorUpdateTemplate);
+    void *unwrapped_buffer = nullptr;
     {
+        // desc_template_map is guarded by the dispatch lock
         std::lock_guard<std::mutex> lock(dispatch_lock);
-        descriptorSet = layer_data->Unwrap(descriptorSet);
-        descriptorUpdateTemplate = (VkDescriptorUpdateTemplate)unique_id_mapping[template_handle];
+        unwrapped_buffer = BuildUnwrappedUpdateTemplateBuffer(layer_data, template_handle, pData);
     }
-    void *unwrapped_buffer = BuildUnwrappedUpdateTemplateBuffer(layer_data, template_handle, pData);
     layer_data->device_dispatch_table.UpdateDescriptorSetWithTemplate(device, descriptorSet, descriptorUpdateTemplate, unwrapped_buffer);
-    free(unwrapped_buffer);
 }
 
 void DispatchUpdateDescriptorSetWithTemplateKHR(VkDevice device, VkDescriptorSet descriptorSet,
@@ -768,15 +848,15 @@ void DispatchUpdateDescriptorSetWithTemplateKHR(VkDevice device, VkDescriptorSet
         return layer_data->device_dispatch_table.UpdateDescriptorSetWithTemplateKHR(device, descriptorSet, descriptorUpdateTemplate,
                                                                                     pData);
     uint64_t template_handle = reinterpret_cast<uint64_t &>(descriptorUpdateTemplate);
+    descriptorSet = layer_data->Unwrap(descriptorSet);
+    descriptorUpdateTemplate = layer_data->Unwrap(descriptorUpdateTemplate);
     void *unwrapped_buffer = nullptr;
     {
+        // desc_template_map is guarded by the dispatch lock
         std::lock_guard<std::mutex> lock(dispatch_lock);
-        descriptorSet = layer_data->Unwrap(descriptorSet);
-        descriptorUpdateTemplate = (VkDescriptorUpdateTemplate)unique_id_mapping[template_handle];
         unwrapped_buffer = BuildUnwrappedUpdateTemplateBuffer(layer_data, template_handle, pData);
     }
     layer_data->device_dispatch_table.UpdateDescriptorSetWithTemplateKHR(device, descriptorSet, descriptorUpdateTemplate, unwrapped_buffer);
-    free(unwrapped_buffer);
 }
 
 void DispatchCmdPushDescriptorSetWithTemplateKHR(VkCommandBuffer commandBuffer,
@@ -787,16 +867,16 @@ void DispatchCmdPushDescriptorSetWithTemplateKHR(VkCommandBuffer commandBuffer,
         return layer_data->device_dispatch_table.CmdPushDescriptorSetWithTemplateKHR(commandBuffer, descriptorUpdateTemplate,
                                                                                      layout, set, pData);
     uint64_t template_handle = reinterpret_cast<uint64_t &>(descriptorUpdateTemplate);
+    descriptorUpdateTemplate = layer_data->Unwrap(descriptorUpdateTemplate);
+    layout = layer_data->Unwrap(layout);
     void *unwrapped_buffer = nullptr;
     {
+        // desc_template_map is guarded by the dispatch lock
         std::lock_guard<std::mutex> lock(dispatch_lock);
-        descriptorUpdateTemplate = layer_data->Unwrap(descriptorUpdateTemplate);
-        layout = layer_data->Unwrap(layout);
         unwrapped_buffer = BuildUnwrappedUpdateTemplateBuffer(layer_data, template_handle, pData);
     }
     layer_data->device_dispatch_table.CmdPushDescriptorSetWithTemplateKHR(commandBuffer, descriptorUpdateTemplate, layout, set,
                                                                  unwrapped_buffer);
-    free(unwrapped_buffer);
 }
 
 VkResult DispatchGetPhysicalDeviceDisplayPropertiesKHR(VkPhysicalDevice physicalDevice, uint32_t *pPropertyCount,
@@ -883,14 +963,10 @@ VkResult DispatchGetDisplayModePropertiesKHR(VkPhysicalDevice physicalDevice, Vk
     if (!wrap_handles)
         return layer_data->instance_dispatch_table.GetDisplayModePropertiesKHR(physicalDevice, display, pPropertyCount,
                                                                                pProperties);
-    {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
-        display = layer_data->Unwrap(display);
-    }
+    display = layer_data->Unwrap(display);
 
     VkResult result = layer_data->instance_dispatch_table.GetDisplayModePropertiesKHR(physicalDevice, display, pPropertyCount, pProperties);
     if ((result == VK_SUCCESS || result == VK_INCOMPLETE) && pProperties) {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         for (uint32_t idx0 = 0; idx0 < *pPropertyCount; ++idx0) {
             pProperties[idx0].displayMode = layer_data->WrapNew(pProperties[idx0].displayMode);
         }
@@ -904,15 +980,11 @@ VkResult DispatchGetDisplayModeProperties2KHR(VkPhysicalDevice physicalDevice, V
     if (!wrap_handles)
         return layer_data->instance_dispatch_table.GetDisplayModeProperties2KHR(physicalDevice, display, pPropertyCount,
                                                                                 pProperties);
-    {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
-        display = layer_data->Unwrap(display);
-    }
+    display = layer_data->Unwrap(display);
 
     VkResult result =
         layer_data->instance_dispatch_table.GetDisplayModeProperties2KHR(physicalDevice, display, pPropertyCount, pProperties);
     if ((result == VK_SUCCESS || result == VK_INCOMPLETE) && pProperties) {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
         for (uint32_t idx0 = 0; idx0 < *pPropertyCount; ++idx0) {
             pProperties[idx0].displayModeProperties.displayMode = layer_data->WrapNew(pProperties[idx0].displayModeProperties.displayMode);
         }
@@ -924,12 +996,9 @@ VkResult DispatchDebugMarkerSetObjectTagEXT(VkDevice device, const VkDebugMarker
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.DebugMarkerSetObjectTagEXT(device, pTagInfo);
     safe_VkDebugMarkerObjectTagInfoEXT local_tag_info(pTagInfo);
-    {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
-        auto it = unique_id_mapping.find(reinterpret_cast<uint64_t &>(local_tag_info.object));
-        if (it != unique_id_mapping.end()) {
-            local_tag_info.object = it->second;
-        }
+    uint64_t unwrapped_handle = unique_id_mapping.Unwrap(reinterpret_cast<uint64_t &>(local_tag_info.object));
+    if (unwrapped_handle) {
+        local_tag_info.object = unwrapped_handle;
     }
     VkResult result = layer_data->device_dispatch_table.DebugMarkerSetObjectTagEXT(device, 
                                                                                    reinterpret_cast<VkDebugMarkerObjectTagInfoEXT *>(&local_tag_info));
@@ -940,12 +1009,9 @@ VkResult DispatchDebugMarkerSetObjectNameEXT(VkDevice device, const VkDebugMarke
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.DebugMarkerSetObjectNameEXT(device, pNameInfo);
     safe_VkDebugMarkerObjectNameInfoEXT local_name_info(pNameInfo);
-    {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
-        auto it = unique_id_mapping.find(reinterpret_cast<uint64_t &>(local_name_info.object));
-        if (it != unique_id_mapping.end()) {
-            local_name_info.object = it->second;
-        }
+    uint64_t unwrapped_handle = unique_id_mapping.Unwrap(reinterpret_cast<uint64_t &>(local_name_info.object));
+    if (unwrapped_handle) {
+        local_name_info.object = unwrapped_handle;
     }
     VkResult result = layer_data->device_dispatch_table.DebugMarkerSetObjectNameEXT(
         device, reinterpret_cast<VkDebugMarkerObjectNameInfoEXT *>(&local_name_info));
@@ -957,12 +1023,9 @@ VkResult DispatchSetDebugUtilsObjectTagEXT(VkDevice device, const VkDebugUtilsOb
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.SetDebugUtilsObjectTagEXT(device, pTagInfo);
     safe_VkDebugUtilsObjectTagInfoEXT local_tag_info(pTagInfo);
-    {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
-        auto it = unique_id_mapping.find(reinterpret_cast<uint64_t &>(local_tag_info.objectHandle));
-        if (it != unique_id_mapping.end()) {
-            local_tag_info.objectHandle = it->second;
-        }
+    uint64_t unwrapped_handle = unique_id_mapping.Unwrap(reinterpret_cast<uint64_t &>(local_tag_info.objectHandle));
+    if (unwrapped_handle) {
+        local_tag_info.objectHandle = unwrapped_handle;
     }
     VkResult result = layer_data->device_dispatch_table.SetDebugUtilsObjectTagEXT(
         device, reinterpret_cast<const VkDebugUtilsObjectTagInfoEXT *>(&local_tag_info));
@@ -973,12 +1036,9 @@ VkResult DispatchSetDebugUtilsObjectNameEXT(VkDevice device, const VkDebugUtilsO
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.SetDebugUtilsObjectNameEXT(device, pNameInfo);
     safe_VkDebugUtilsObjectNameInfoEXT local_name_info(pNameInfo);
-    {
-        std::lock_guard<std::mutex> lock(dispatch_lock);
-        auto it = unique_id_mapping.find(reinterpret_cast<uint64_t &>(local_name_info.objectHandle));
-        if (it != unique_id_mapping.end()) {
-            local_name_info.objectHandle = it->second;
-        }
+    uint64_t unwrapped_handle = unique_id_mapping.Unwrap(reinterpret_cast<uint64_t &>(local_name_info.objectHandle));
+    if (unwrapped_handle) {
+        local_name_info.objectHandle = unwrapped_handle;
     }
     VkResult result = layer_data->device_dispatch_table.SetDebugUtilsObjectNameEXT(
         device, reinterpret_cast<const VkDebugUtilsObjectNameInfoEXT *>(&local_name_info));
@@ -1017,6 +1077,7 @@ VkResult DispatchSetDebugUtilsObjectNameEXT(VkDevice device, const VkDebugUtilsO
             'vkCreateDescriptorUpdateTemplateKHR',
             'vkDestroyDescriptorUpdateTemplate',
             'vkDestroyDescriptorUpdateTemplateKHR',
+            'vkUpdateDescriptorSets',
             'vkUpdateDescriptorSetWithTemplate',
             'vkUpdateDescriptorSetWithTemplateKHR',
             'vkCmdPushDescriptorSetWithTemplateKHR',
@@ -1281,10 +1342,6 @@ VkResult DispatchSetDebugUtilsObjectNameEXT(VkDevice device, const VkDebugUtilsO
         self.structMembers.append(self.StructMemberData(name=typeName, members=membersInfo))
 
     #
-    # Insert a lock_guard line
-    def lock_guard(self, indent):
-        return '%sstd::lock_guard<std::mutex> lock(dispatch_lock);\n' % indent
-    #
     # Determine if a struct has an NDO as a member or an embedded member
     def struct_contains_ndo(self, struct_item):
         struct_member_dict = dict(self.structMembers)
@@ -1429,7 +1486,6 @@ VkResult DispatchSetDebugUtilsObjectNameEXT(VkDevice device, const VkDebugUtilsO
             handle_name = params[-1].find('name')
             create_ndo_code += '%sif (VK_SUCCESS == result) {\n' % (indent)
             indent = self.incIndent(indent)
-            create_ndo_code += '%sstd::lock_guard<std::mutex> lock(dispatch_lock);\n' % (indent)
             ndo_dest = '*%s' % handle_name.text
             if ndo_array == True:
                 create_ndo_code += '%sfor (uint32_t index0 = 0; index0 < %s; index0++) {\n' % (indent, cmd_info[-1].len)
@@ -1459,23 +1515,17 @@ VkResult DispatchSetDebugUtilsObjectNameEXT(VkDevice device, const VkDebugUtilsO
                     # This API is freeing an array of handles.  Remove them from the unique_id map.
                     destroy_ndo_code += '%sif ((VK_SUCCESS == result) && (%s)) {\n' % (indent, cmd_info[param].name)
                     indent = self.incIndent(indent)
-                    destroy_ndo_code += '%sstd::unique_lock<std::mutex> lock(dispatch_lock);\n' % (indent)
                     destroy_ndo_code += '%sfor (uint32_t index0 = 0; index0 < %s; index0++) {\n' % (indent, cmd_info[param].len)
                     indent = self.incIndent(indent)
                     destroy_ndo_code += '%s%s handle = %s[index0];\n' % (indent, cmd_info[param].type, cmd_info[param].name)
-                    destroy_ndo_code += '%suint64_t unique_id = reinterpret_cast<uint64_t &>(handle);\n' % (indent)
-                    destroy_ndo_code += '%sunique_id_mapping.erase(unique_id);\n' % (indent)
+                    destroy_ndo_code += '%sunique_id_mapping.Remove(reinterpret_cast<uint64_t &>(handle));\n' % (indent)
                     indent = self.decIndent(indent);
                     destroy_ndo_code += '%s}\n' % indent
                     indent = self.decIndent(indent);
                     destroy_ndo_code += '%s}\n' % indent
                 else:
                     # Remove a single handle from the map
-                    destroy_ndo_code += '%sstd::unique_lock<std::mutex> lock(dispatch_lock);\n' % (indent)
-                    destroy_ndo_code += '%suint64_t %s_id = reinterpret_cast<uint64_t &>(%s);\n' % (indent, cmd_info[param].name, cmd_info[param].name)
-                    destroy_ndo_code += '%s%s = (%s)unique_id_mapping[%s_id];\n' % (indent, cmd_info[param].name, cmd_info[param].type, cmd_info[param].name)
-                    destroy_ndo_code += '%sunique_id_mapping.erase(%s_id);\n' % (indent, cmd_info[param].name)
-                    destroy_ndo_code += '%slock.unlock();\n' % (indent)
+                    destroy_ndo_code += '%s%s = (%s)unique_id_mapping.Remove(reinterpret_cast<uint64_t &>(%s));\n' % (indent, cmd_info[param].name, cmd_info[param].type, cmd_info[param].name)
         return ndo_array, destroy_ndo_code
 
     #
@@ -1673,7 +1723,7 @@ VkResult DispatchSetDebugUtilsObjectNameEXT(VkDevice device, const VkDebugUtilsO
                     param_pre_code += destroy_ndo_code
             if param_pre_code:
                 if (not destroy_func) or (destroy_array):
-                    param_pre_code = '%s{\n%s%s%s%s}\n' % ('    ', indent, self.lock_guard(indent), param_pre_code, indent)
+                    param_pre_code = '%s{\n%s%s}\n' % ('    ', param_pre_code, indent)
         return paramdecl, param_pre_code, param_post_code
     #
     # Capture command parameter info needed to wrap NDOs as well as handling some boilerplate code
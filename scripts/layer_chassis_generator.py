@@ -99,6 +99,7 @@ class LayerChassisGeneratorOptions(GeneratorOptions):
         self.indentFuncProto = indentFuncProto
         self.indentFuncPointer = indentFuncPointer
         self.alignFuncParam  = alignFuncParam
+        self.helper_file_type = helper_file_type
 
 # LayerChassisOutputGenerator - subclass of OutputGenerator.
 # Generates a LayerFactory layer that intercepts all API entrypoints
@@ -152,6 +153,20 @@ class LayerChassisOutputGenerator(OutputGenerator):
         'vkGetPhysicalDeviceProcAddr',
         ]
 
+    profiled_manual_functions = [
+        # Include manually implemented functions here that run the validation object hooks, so that they are profiled
+        'vkCreateDevice',
+        'vkDestroyDevice',
+        'vkCreateInstance',
+        'vkDestroyInstance',
+        'vkCreateGraphicsPipelines',
+        'vkCreateComputePipelines',
+        'vkCreateRayTracingPipelinesNV',
+        'vkCreatePipelineLayout',
+        'vkCreateShaderModule',
+        'vkAllocateDescriptorSets',
+        ]
+
     alt_ret_codes = [
         # Include functions here which must tolerate VK_INCOMPLETE as a return code
         'vkEnumeratePhysicalDevices',
@@ -192,13 +207,156 @@ class LayerChassisOutputGenerator(OutputGenerator):
         'vkDestroyDebugUtilsMessengerEXT' : 'layer_destroy_messenger_callback(layer_data->report_data, messenger, pAllocator);',
         }
 
+    exclusive_validate_functions = [
+        # Include functions here whose PreCallValidate hooks also update tracked state, and so must hold the
+        # validation object lock exclusively rather than shared. Frame sampling never skips them.
+        'vkQueueSubmit',
+        'vkQueueBindSparse',
+        'vkQueuePresentKHR',
+        'vkGetPhysicalDeviceQueueFamilyProperties',
+        'vkGetPhysicalDeviceQueueFamilyProperties2',
+        'vkGetPhysicalDeviceQueueFamilyProperties2KHR',
+        ]
+
+    recording_validate_functions = [
+        # Include functions here whose PreCallValidate hooks queue checks that run later, such as the checks of a secondary
+        # command buffer that wait for the framebuffer it executes in. Frame sampling never skips them.
+        'vkCmdClearAttachments',
+        'vkCmdPipelineBarrier',
+        ]
+
+    exclusive_command_buffer_record_functions = [
+        # Include vkCmd* functions here whose record hooks update state belonging to other command buffers, and so
+        # cannot use the per-command-buffer lock
+        'vkCmdExecuteCommands',
+        ]
+
+    deferred_command_buffer_functions = [
+        # Include non-vkCmd* functions here that only update the state of their command buffer, and so can be deferred
+        # in order with the vkCmd* calls recorded into it
+        'vkBeginCommandBuffer',
+        'vkEndCommandBuffer',
+        'vkResetCommandBuffer',
+        ]
+
+    deferred_barrier_functions = [
+        # Include functions here that can be deferred, but must be ordered against the work for every command buffer
+        'vkQueueSubmit',
+        ]
+
+    deferred_sync_prefixes = (
+        # Non-deferred device functions starting with these wait for outstanding deferred work before their hooks run: they
+        # release, reset or wait on objects that deferred calls may still be recording, or bind state that recording reads
+        'vkDestroy',
+        'vkFree',
+        'vkReset',
+        'vkWait',
+        'vkQueue',
+        'vkBind',
+        'vkAcquireNextImage',
+        )
+
+    deferred_sync_functions = [
+        # Include other non-deferred device functions here whose hooks must observe the state recorded by earlier deferred calls
+        'vkDeviceWaitIdle',
+        'vkGetFenceStatus',
+        'vkGetEventStatus',
+        'vkSetEvent',
+        'vkGetQueryPoolResults',
+        'vkUpdateDescriptorSets',
+        'vkUpdateDescriptorSetWithTemplate',
+        'vkUpdateDescriptorSetWithTemplateKHR',
+        ]
+
+    capture_ignore_functions = [
+        # Include functions here that API captures leave out: the layer answers them itself, or they never reach the driver
+        'vkGetDeviceProcAddr',
+        'vkGetInstanceProcAddr',
+        'vkEnumerateInstanceLayerProperties',
+        'vkEnumerateInstanceExtensionProperties',
+        'vkEnumerateDeviceLayerProperties',
+        'vkEnumerateDeviceExtensionProperties',
+        'vkCreateValidationCacheEXT',
+        'vkDestroyValidationCacheEXT',
+        'vkMergeValidationCachesEXT',
+        'vkGetValidationCacheDataEXT',
+        'vkGetPhysicalDeviceProcAddr',
+        ]
+
+    capture_pointer_conditions = {
+        # Struct members whose pointers the implementation ignores in some cases, when applications may leave them dangling,
+        # with the condition under which they are used. Captures record them as null otherwise.
+        ('VkWriteDescriptorSet', 'pImageInfo') : 'CaptureUsesImageInfo(value.descriptorType)',
+        ('VkWriteDescriptorSet', 'pBufferInfo') : 'CaptureUsesBufferInfo(value.descriptorType)',
+        ('VkWriteDescriptorSet', 'pTexelBufferView') : 'CaptureUsesTexelBufferView(value.descriptorType)',
+        ('VkDescriptorSetLayoutBinding', 'pImmutableSamplers') : 'CaptureUsesImmutableSamplers(value.descriptorType)',
+        ('VkGraphicsPipelineCreateInfo', 'pTessellationState') : 'CaptureUsesTessellationState(value)',
+        ('VkGraphicsPipelineCreateInfo', 'pViewportState') : 'CaptureUsesRasterizationState(value)',
+        ('VkGraphicsPipelineCreateInfo', 'pMultisampleState') : 'CaptureUsesRasterizationState(value)',
+        ('VkGraphicsPipelineCreateInfo', 'pDepthStencilState') : 'CaptureUsesRasterizationState(value)',
+        ('VkGraphicsPipelineCreateInfo', 'pColorBlendState') : 'CaptureUsesRasterizationState(value)',
+        ('VkBufferCreateInfo', 'pQueueFamilyIndices') : 'value.sharingMode == VK_SHARING_MODE_CONCURRENT',
+        ('VkImageCreateInfo', 'pQueueFamilyIndices') : 'value.sharingMode == VK_SHARING_MODE_CONCURRENT',
+        ('VkSwapchainCreateInfoKHR', 'pQueueFamilyIndices') : 'value.imageSharingMode == VK_SHARING_MODE_CONCURRENT',
+        }
+
+    capture_param_sizes = {
+        # Untyped command parameters whose size comes from elsewhere
+        ('vkUpdateDescriptorSetWithTemplate', 'pData') : 'capture->UpdateTemplateDataSize(HandleToUint64(descriptorUpdateTemplate))',
+        ('vkUpdateDescriptorSetWithTemplateKHR', 'pData') : 'capture->UpdateTemplateDataSize(HandleToUint64(descriptorUpdateTemplate))',
+        ('vkCmdPushDescriptorSetWithTemplateKHR', 'pData') : 'capture->UpdateTemplateDataSize(HandleToUint64(descriptorUpdateTemplate))',
+        }
+
+    capture_post_statements = {
+        # Bookkeeping done by the capture of a call, after its record is written
+        'vkCreateDescriptorUpdateTemplate' : 'if (result == VK_SUCCESS) capture->AddUpdateTemplate(HandleToUint64(*pDescriptorUpdateTemplate), pCreateInfo);',
+        'vkCreateDescriptorUpdateTemplateKHR' : 'if (result == VK_SUCCESS) capture->AddUpdateTemplate(HandleToUint64(*pDescriptorUpdateTemplate), pCreateInfo);',
+        'vkDestroyDescriptorUpdateTemplate' : 'capture->RemoveUpdateTemplate(HandleToUint64(descriptorUpdateTemplate));',
+        'vkDestroyDescriptorUpdateTemplateKHR' : 'capture->RemoveUpdateTemplate(HandleToUint64(descriptorUpdateTemplate));',
+        }
+
+    replay_manual_functions = [
+        # Include functions here that the replayer implements itself once their parameters are decoded, instead of passing them
+        # straight to the chassis intercept
+        'vkCreateInstance',
+        'vkCreateDevice',
+        'vkCreateDebugUtilsMessengerEXT',
+        'vkDestroyDebugUtilsMessengerEXT',
+        'vkCreateDebugReportCallbackEXT',
+        'vkDestroyDebugReportCallbackEXT',
+        ]
+
+    replay_manual_stubs = [
+        # Include functions here whose down-chain stub the replayer implements itself, to answer the queries that validation
+        # objects make on their own or to hand out host memory for mappings
+        'vkGetInstanceProcAddr',
+        'vkGetDeviceProcAddr',
+        'vkAllocateMemory',
+        'vkFreeMemory',
+        'vkMapMemory',
+        'vkGetBufferMemoryRequirements',
+        'vkGetImageMemoryRequirements',
+        'vkGetPhysicalDeviceProperties',
+        'vkGetPhysicalDeviceProperties2',
+        'vkGetPhysicalDeviceProperties2KHR',
+        'vkGetPhysicalDeviceFeatures',
+        'vkGetPhysicalDeviceMemoryProperties',
+        'vkGetPhysicalDeviceQueueFamilyProperties',
+        'vkGetPhysicalDeviceFormatProperties',
+        'vkGetPhysicalDeviceImageFormatProperties',
+        'vkGetPhysicalDeviceImageFormatProperties2',
+        'vkGetPhysicalDeviceImageFormatProperties2KHR',
+        ]
+
     precallvalidate_loop = "for (auto intercept : layer_data->object_dispatch) {"
     precallrecord_loop = precallvalidate_loop
     postcallrecord_loop = "for (auto intercept : layer_data->object_dispatch) {"
 
     inline_custom_header_preamble = """
 #define NOMINMAX
+#include <atomic>
 #include <mutex>
+#include <shared_mutex>
 #include <cinttypes>
 #include <stdio.h>
 #include <stdlib.h>
@@ -212,6 +370,11 @@ class LayerChassisOutputGenerator(OutputGenerator):
 #include "vulkan/vulkan.h"
 #include "vk_layer_config.h"
 #include "vk_layer_data.h"
+#include "deferred_validation.h"
+#include "chassis_capture.h"
+#include "chassis_handle_table.h"
+#include "chassis_profiler.h"
+#include "chassis_trace.h"
 #include "vk_layer_logging.h"
 #include "vk_object_types.h"
 #include "vulkan/vk_layer.h"
@@ -225,8 +388,20 @@ class LayerChassisOutputGenerator(OutputGenerator):
 #include "vk_typemap_helper.h"
 
 
-extern uint64_t global_unique_id;
-extern std::unordered_map<uint64_t, uint64_t> unique_id_mapping;
+extern WrappedHandleTable unique_id_mapping;
+
+// Validation object lock guards. PreCallValidate hooks only read tracked state and share the validation object lock,
+// while the PreCallRecord/PostCallRecord hooks that update state take it exclusively.
+typedef std::shared_lock<std::shared_timed_mutex> read_lock_guard_t;
+typedef std::unique_lock<std::shared_timed_mutex> write_lock_guard_t;
+
+// Lock guard for the state-recording hooks of vkCmd* entry points. By default it holds the validation object lock
+// exclusively; objects that shard command buffer state may instead hold it shared plus a per-command-buffer lock.
+struct command_buffer_lock_guard_t {
+    read_lock_guard_t shared_lock;
+    write_lock_guard_t exclusive_lock;
+    std::unique_lock<std::mutex> command_buffer_lock;
+};
 """
 
     inline_custom_header_class_definition = """
@@ -241,9 +416,21 @@ enum LayerObjectTypeId {
     LayerObjectTypeCoreValidation,              // Instance or device core validation layer object
 };
 
+// One descriptor of an update template's pData, as the handle-wrapping dispatch code copies it
+struct TemplateUnwrapEntry {
+    size_t offset;
+    VulkanObjectType type;  // kVulkanObjectTypeImage for a VkDescriptorImageInfo, kVulkanObjectTypeBuffer for a
+                            // VkDescriptorBufferInfo, kVulkanObjectTypeBufferView for a VkBufferView, or
+                            // kVulkanObjectTypeUnknown for the bytes of an inline uniform block
+    size_t size;
+};
+
 struct TEMPLATE_STATE {
     VkDescriptorUpdateTemplateKHR desc_update_template;
     safe_VkDescriptorUpdateTemplateCreateInfo create_info;
+    // Built at template creation when handles are wrapped, so that updates only have to walk the list
+    std::vector<TemplateUnwrapEntry> unwrap_entries;
+    size_t unwrapped_data_size = 0;
 
     TEMPLATE_STATE(VkDescriptorUpdateTemplateKHR update_template, safe_VkDescriptorUpdateTemplateCreateInfo *pCreateInfo)
         : desc_update_template(update_template), create_info(*pCreateInfo) {}
@@ -263,6 +450,11 @@ typedef enum ValidationCheckDisables {
     VALIDATION_CHECK_DISABLE_QUERY_VALIDATION,
 } ValidationCheckDisables;
 
+typedef enum ValidationCheckEnables {
+    VALIDATION_CHECK_ENABLE_PER_COMMAND_BUFFER_LOCKING,
+    VALIDATION_CHECK_ENABLE_LAZY_COMMAND_BUFFER_INVALIDATION,
+} ValidationCheckEnables;
+
 
 // CHECK_DISABLED struct is a container for bools that can block validation checks from being performed.
 // These bools are all "false" by default meaning that all checks are enabled. Enum values can be specified
@@ -287,8 +479,10 @@ struct CHECK_DISABLED {
 struct CHECK_ENABLED {
     bool gpu_validation;
     bool gpu_validation_reserve_binding_slot;
+    bool per_command_buffer_locking;                // Record vkCmd* state under a per-command-buffer lock
+    bool lazy_command_buffer_invalidation;          // Find destroyed or updated bound objects at end and submit time
 
-    void SetAll(bool value) { std::fill(&gpu_validation, &gpu_validation_reserve_binding_slot + 1, value); }
+    void SetAll(bool value) { std::fill(&gpu_validation, &lazy_command_buffer_invalidation + 1, value); }
 };
 
 // Layer chassis validation object base class definition
@@ -313,6 +507,8 @@ class ValidationObject {
         LAYER_PHYS_DEV_PROPERTIES phys_dev_properties = {};
 
         std::vector<ValidationObject*> object_dispatch;
+        // Per-intercept lists of the validation objects that actually implement each hook, indexed by InterceptId
+        std::vector<std::vector<ValidationObject*>> intercept_vectors;
         LayerObjectTypeId container_type;
 
         std::string layer_name = "CHASSIS";
@@ -322,10 +518,33 @@ class ValidationObject {
         // Destructor
         virtual ~ValidationObject() {};
 
-        std::mutex validation_object_mutex;
-        virtual std::unique_lock<std::mutex> write_lock() {
-            return std::unique_lock<std::mutex>(validation_object_mutex);
+        // Worker pool running deferred validation for this device, or null when validating synchronously
+        std::unique_ptr<DeferredValidation> deferred_validation;
+        // Hook call counts and timings, or null when profiling is disabled
+        ChassisProfiler* profiler = nullptr;
+        // Frame sampling: when sample_frames is above one, the PreCallValidate hooks of most device commands only run in
+        // one frame out of every sample_frames, counted by vkQueuePresentKHR. The record hooks always run.
+        uint32_t sample_frames = 0;
+        std::atomic<uint64_t> presented_frames{0};
+        bool ValidateCurrentFrame() const {
+            return sample_frames <= 1 || presented_frames.load(std::memory_order_relaxed) % sample_frames == 0;
+        }
+
+        std::shared_timed_mutex validation_object_mutex;
+        virtual read_lock_guard_t read_lock() {
+            return read_lock_guard_t(validation_object_mutex);
         }
+        virtual write_lock_guard_t write_lock() {
+            return write_lock_guard_t(validation_object_mutex);
+        }
+        virtual command_buffer_lock_guard_t command_buffer_write_lock(VkCommandBuffer command_buffer) {
+            command_buffer_lock_guard_t guard;
+            guard.exclusive_lock = write_lock();
+            return guard;
+        }
+
+        // Build intercept_vectors from object_dispatch -- must be called whenever object_dispatch changes
+        void InitObjectDispatchVectors();
 
         ValidationObject* GetValidationObject(std::vector<ValidationObject*>& object_dispatch, LayerObjectTypeId object_type) {
             for (auto validation_object : object_dispatch) {
@@ -353,25 +572,21 @@ class ValidationObject {
         std::unordered_map<VkDescriptorPool, std::unordered_set<VkDescriptorSet>> pool_descriptor_sets_map;
 
 
-        // Unwrap a handle.  Must hold lock.
+        // Unwrap a handle. Does not need the dispatch lock.
         template <typename HandleType>
         HandleType Unwrap(HandleType wrappedHandle) {
-            // TODO: don't use operator[] here.
-            return (HandleType)unique_id_mapping[reinterpret_cast<uint64_t const &>(wrappedHandle)];
+            return (HandleType)unique_id_mapping.Unwrap(reinterpret_cast<uint64_t const &>(wrappedHandle));
         }
 
-        // Wrap a newly created handle with a new unique ID, and return the new ID -- must hold lock.
+        // Wrap a newly created handle with a new unique ID, and return the new ID. Does not need the dispatch lock.
         template <typename HandleType>
         HandleType WrapNew(HandleType newlyCreatedHandle) {
-            auto unique_id = global_unique_id++;
-            unique_id_mapping[unique_id] = reinterpret_cast<uint64_t const &>(newlyCreatedHandle);
-            return (HandleType)unique_id;
+            return (HandleType)unique_id_mapping.Wrap(reinterpret_cast<uint64_t const &>(newlyCreatedHandle));
         }
 
         // Specialized handling for VkDisplayKHR. Adds an entry to enable reverse-lookup. Must hold lock.
         VkDisplayKHR WrapDisplay(VkDisplayKHR newlyCreatedHandle, ValidationObject *map_data) {
-            auto unique_id = global_unique_id++;
-            unique_id_mapping[unique_id] = reinterpret_cast<uint64_t const &>(newlyCreatedHandle);
+            auto unique_id = unique_id_mapping.Wrap(reinterpret_cast<uint64_t const &>(newlyCreatedHandle));
             map_data->display_id_reverse_mapping[newlyCreatedHandle] = unique_id;
             return (VkDisplayKHR)unique_id;
         }
@@ -413,22 +628,35 @@ class ValidationObject {
  * Author: Mark Lobodzinski <mark@lunarg.com>
  */"""
 
+    inline_custom_replay_preamble = """
+
+#include <string.h>
+#include <string>
+#include <unordered_map>
+
+#include "chassis.h"
+#include "vk_layer_replay.h"
+
+namespace vulkan_layer_replay {
+"""
+
     inline_custom_source_preamble = """
 
 #include <string.h>
+#include <array>
 #include <mutex>
+#include <type_traits>
+#include <vector>
 
 #define VALIDATION_ERROR_MAP_IMPL
 
 #include "chassis.h"
 #include "layer_chassis_dispatch.h"
 
-std::unordered_map<void*, ValidationObject*> layer_data_map;
+layer_data_table<ValidationObject> layer_data_map;
 
-// Global unique object identifier.  All increments must be guarded by a lock.
-uint64_t global_unique_id = 1;
 // Map uniqueID to actual object handle
-std::unordered_map<uint64_t, uint64_t> unique_id_mapping;
+WrappedHandleTable unique_id_mapping;
 
 // TODO: This variable controls handle wrapping -- in the future it should be hooked
 //       up to the new VALIDATION_FEATURES extension. Temporarily, control with a compile-time flag.
@@ -484,7 +712,17 @@ static const VkLayerProperties global_layer = {
 static const VkExtensionProperties instance_extensions[] = {{VK_EXT_DEBUG_REPORT_EXTENSION_NAME, VK_EXT_DEBUG_REPORT_SPEC_VERSION},
                                                             {VK_EXT_DEBUG_UTILS_EXTENSION_NAME, VK_EXT_DEBUG_UTILS_SPEC_VERSION}};
 
-extern const std::unordered_map<std::string, void*> name_to_funcptr_map;
+// An intercepted command. device_extension names the device extension that provides a device-level command, and must be
+// enabled for vkGetDeviceProcAddr to return it.
+struct InterceptEntry {
+    const char *name;
+    void *funcptr;
+    const char *device_extension;
+};
+
+const InterceptEntry *FindIntercept(const char *name);
+
+void CaptureEncodePNext(ApiCaptureEncoder &encoder, const void *next);
 
 
 // Manually written functions
@@ -566,6 +804,25 @@ void SetValidationDisable(CHECK_DISABLED* disable_data, const ValidationCheckDis
     }
 }
 
+static const std::unordered_map<std::string, ValidationCheckEnables> ValidationEnableLookup = {
+    {"VALIDATION_CHECK_ENABLE_PER_COMMAND_BUFFER_LOCKING", VALIDATION_CHECK_ENABLE_PER_COMMAND_BUFFER_LOCKING},
+    {"VALIDATION_CHECK_ENABLE_LAZY_COMMAND_BUFFER_INVALIDATION", VALIDATION_CHECK_ENABLE_LAZY_COMMAND_BUFFER_INVALIDATION},
+};
+
+// Set the local enable flag for the appropriate VALIDATION_CHECK_ENABLE enum
+void SetValidationEnable(CHECK_ENABLED* enable_data, const ValidationCheckEnables enable_id) {
+    switch (enable_id) {
+        case VALIDATION_CHECK_ENABLE_PER_COMMAND_BUFFER_LOCKING:
+            enable_data->per_command_buffer_locking = true;
+            break;
+        case VALIDATION_CHECK_ENABLE_LAZY_COMMAND_BUFFER_INVALIDATION:
+            enable_data->lazy_command_buffer_invalidation = true;
+            break;
+        default:
+            assert(true);
+    }
+}
+
 // Set the local disable flag for a single VK_VALIDATION_FEATURE_DISABLE_* flag
 void SetValidationFeatureDisable(CHECK_DISABLED* disable_data, const VkValidationFeatureDisableEXT feature_disable) {
     switch (feature_disable) {
@@ -656,6 +913,12 @@ void SetLocalEnableSetting(std::string list_of_enables, std::string delimiter, C
                 SetValidationFeatureEnable(enables, result->second);
             }
         }
+        if (token.find("VALIDATION_CHECK_ENABLE_") != std::string::npos) {
+            auto result = ValidationEnableLookup.find(token);
+            if (result != ValidationEnableLookup.end()) {
+                SetValidationEnable(enables, result->second);
+            }
+        }
         list_of_enables.erase(0, pos + delimiter.length());
     }
 }
@@ -710,16 +973,144 @@ void ProcessConfigAndEnvSettings(const char* layer_description, CHECK_ENABLED* e
 }
 
 
+// Process-wide hook profiler, created when the vk_layer_settings.txt config file names a profile output file
+ChassisProfiler* GetChassisProfiler(const char* layer_description) {
+    static std::unique_ptr<ChassisProfiler> profiler = [layer_description]() {
+        std::string output_key = layer_description;
+        output_key.append(".profile_output");
+        std::string output_path = getLayerOption(output_key.c_str());
+        if (output_path.empty()) return std::unique_ptr<ChassisProfiler>();
+        return std::unique_ptr<ChassisProfiler>(new ChassisProfiler(output_path, InterceptIdCount, intercept_id_names));
+    }();
+    return profiler.get();
+}
+
+// Process-wide trace event recorder, created when the vk_layer_settings.txt config file names a trace output file
+ChassisTracer* GetChassisTracer(const char* layer_description) {
+    static std::unique_ptr<ChassisTracer> tracer = [layer_description]() {
+        std::string output_key = layer_description;
+        output_key.append(".trace_output");
+        std::string output_path = getLayerOption(output_key.c_str());
+        if (output_path.empty()) return std::unique_ptr<ChassisTracer>();
+        return std::unique_ptr<ChassisTracer>(new ChassisTracer(output_path, intercept_id_names));
+    }();
+    return tracer.get();
+}
+
+// Process-wide API capture, created when the vk_layer_settings.txt config file names a capture output file. It is never
+// deleted: its writer thread is stopped and joined when the last instance is destroyed, and one left running by an application
+// that exits without destroying its instances is not joined from a static destructor while the layer is being unloaded.
+ApiCapture* GetApiCapture(const char* layer_description) {
+    static ApiCapture* capture = [layer_description]() -> ApiCapture* {
+        std::string output_key = layer_description;
+        output_key.append(".capture_output");
+        std::string output_path = getLayerOption(output_key.c_str());
+        if (output_path.empty()) return nullptr;
+        return new ApiCapture(output_path, CaptureIdCount, capture_id_names);
+    }();
+    return capture;
+}
+
+// Capture what the validation objects query from a physical device behind the application's back when a device is created,
+// so that a replay can answer the same queries without the device: its properties, features, memory properties, queue
+// families and format properties, and the extension properties that CoreChecks reads for the enabled device extensions.
+static void CapturePhysicalDeviceState(ApiCapture *capture, ValidationObject *instance_interceptor, VkPhysicalDevice gpu,
+                                       const DeviceExtensions &device_extensions) {
+    const auto &table = instance_interceptor->instance_dispatch_table;
+    VkPhysicalDeviceProperties properties = {};
+    VkPhysicalDeviceFeatures features = {};
+    VkPhysicalDeviceMemoryProperties memory_properties = {};
+    table.GetPhysicalDeviceProperties(gpu, &properties);
+    table.GetPhysicalDeviceFeatures(gpu, &features);
+    table.GetPhysicalDeviceMemoryProperties(gpu, &memory_properties);
+    uint32_t queue_family_count = 0;
+    table.GetPhysicalDeviceQueueFamilyProperties(gpu, &queue_family_count, nullptr);
+    std::vector<VkQueueFamilyProperties> queue_families(queue_family_count);
+    table.GetPhysicalDeviceQueueFamilyProperties(gpu, &queue_family_count, queue_families.data());
+    std::vector<VkFormatProperties> format_properties(VK_FORMAT_RANGE_SIZE);
+    for (uint32_t format = 0; format < VK_FORMAT_RANGE_SIZE; ++format) {
+        table.GetPhysicalDeviceFormatProperties(gpu, static_cast<VkFormat>(format), &format_properties[format]);
+    }
+
+    auto push_descriptor_props = lvl_init_struct<VkPhysicalDevicePushDescriptorPropertiesKHR>();
+    auto descriptor_indexing_props = lvl_init_struct<VkPhysicalDeviceDescriptorIndexingPropertiesEXT>();
+    auto shading_rate_image_props = lvl_init_struct<VkPhysicalDeviceShadingRateImagePropertiesNV>();
+    auto mesh_shader_props = lvl_init_struct<VkPhysicalDeviceMeshShaderPropertiesNV>();
+    auto inline_uniform_block_props = lvl_init_struct<VkPhysicalDeviceInlineUniformBlockPropertiesEXT>();
+    auto vtx_attrib_divisor_props = lvl_init_struct<VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT>();
+    auto depth_stencil_resolve_props = lvl_init_struct<VkPhysicalDeviceDepthStencilResolvePropertiesKHR>();
+    auto transform_feedback_props = lvl_init_struct<VkPhysicalDeviceTransformFeedbackPropertiesEXT>();
+    auto cooperative_matrix_props = lvl_init_struct<VkPhysicalDeviceCooperativeMatrixPropertiesNV>();
+    const std::pair<bool, VkBaseOutStructure *> extension_props[] = {
+        {device_extensions.vk_khr_push_descriptor, reinterpret_cast<VkBaseOutStructure *>(&push_descriptor_props)},
+        {device_extensions.vk_ext_descriptor_indexing, reinterpret_cast<VkBaseOutStructure *>(&descriptor_indexing_props)},
+        {device_extensions.vk_nv_shading_rate_image, reinterpret_cast<VkBaseOutStructure *>(&shading_rate_image_props)},
+        {device_extensions.vk_nv_mesh_shader, reinterpret_cast<VkBaseOutStructure *>(&mesh_shader_props)},
+        {device_extensions.vk_ext_inline_uniform_block, reinterpret_cast<VkBaseOutStructure *>(&inline_uniform_block_props)},
+        {device_extensions.vk_ext_vertex_attribute_divisor, reinterpret_cast<VkBaseOutStructure *>(&vtx_attrib_divisor_props)},
+        {device_extensions.vk_khr_depth_stencil_resolve, reinterpret_cast<VkBaseOutStructure *>(&depth_stencil_resolve_props)},
+        {device_extensions.vk_ext_transform_feedback, reinterpret_cast<VkBaseOutStructure *>(&transform_feedback_props)},
+        {device_extensions.vk_nv_cooperative_matrix, reinterpret_cast<VkBaseOutStructure *>(&cooperative_matrix_props)},
+    };
+    auto properties2 = lvl_init_struct<VkPhysicalDeviceProperties2KHR>();
+    VkBaseOutStructure *chain_end = reinterpret_cast<VkBaseOutStructure *>(&properties2);
+    for (const auto &extension_prop : extension_props) {
+        if (!extension_prop.first) continue;
+        chain_end->pNext = extension_prop.second;
+        chain_end = extension_prop.second;
+    }
+    if (properties2.pNext && table.GetPhysicalDeviceProperties2KHR) {
+        table.GetPhysicalDeviceProperties2KHR(gpu, &properties2);
+    } else {
+        properties2.pNext = nullptr;
+    }
+
+    ApiCaptureEncoder &encoder = capture->BeginRecord();
+    encoder.Value(HandleToUint64(gpu));
+    encoder.Value(properties);
+    encoder.Value(features);
+    encoder.Value(memory_properties);
+    encoder.Array(queue_families.data(), queue_families.size());
+    encoder.Array(format_properties.data(), format_properties.size());
+    CaptureEncodePNext(encoder, properties2.pNext);
+    capture->Record(CaptureIdPhysicalDeviceState, encoder);
+}
+
+// Number of deferred validation worker threads requested through the vk_layer_settings.txt config file, or when the file does
+// not set it the VK_LAYER_DEFERRED_VALIDATION_THREADS environment variable, or zero to validate synchronously on the calling thread
+uint32_t GetDeferredValidationThreadCount(const char* layer_description) {
+    static const uint32_t kMaxDeferredValidationThreads = 16;
+    std::string thread_count_key = layer_description;
+    thread_count_key.append(".deferred_validation_threads");
+    std::string thread_count = getLayerOption(thread_count_key.c_str());
+    if (thread_count.empty()) thread_count = GetLayerEnvVar("VK_LAYER_DEFERRED_VALIDATION_THREADS");
+    if (thread_count.empty()) return 0;
+    return std::min(static_cast<uint32_t>(strtoul(thread_count.c_str(), nullptr, 10)), kMaxDeferredValidationThreads);
+}
+
+// Frame sampling interval requested through the vk_layer_settings.txt config file, or zero to validate every frame
+uint32_t GetSampleFrames(const char* layer_description) {
+    std::string sample_frames_key = layer_description;
+    sample_frames_key.append(".sample_frames");
+    std::string sample_frames = getLayerOption(sample_frames_key.c_str());
+    if (sample_frames.empty()) return 0;
+    return static_cast<uint32_t>(strtoul(sample_frames.c_str(), nullptr, 10));
+}
+
+
 // Non-code-generated chassis API functions
 
 VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetDeviceProcAddr(VkDevice device, const char *funcName) {
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
-    if (!ApiParentExtensionEnabled(funcName, layer_data->device_extensions.device_extension_set)) {
+    const auto &enabled_extensions = layer_data->device_extensions.device_extension_set;
+    // Intercepted commands carry their parent extension; the others are looked up in vk_dispatch_table_helper.h
+    const InterceptEntry *item = FindIntercept(funcName);
+    if (item ? (item->device_extension && !enabled_extensions.count(item->device_extension))
+             : !ApiParentExtensionEnabled(funcName, enabled_extensions)) {
         return nullptr;
     }
-    const auto &item = name_to_funcptr_map.find(funcName);
-    if (item != name_to_funcptr_map.end()) {
-        return reinterpret_cast<PFN_vkVoidFunction>(item->second);
+    if (item && item->funcptr) {
+        return reinterpret_cast<PFN_vkVoidFunction>(item->funcptr);
     }
     auto &table = layer_data->device_dispatch_table;
     if (!table.GetDeviceProcAddr) return nullptr;
@@ -727,9 +1118,9 @@ VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetDeviceProcAddr(VkDevice device, cons
 }
 
 VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetInstanceProcAddr(VkInstance instance, const char *funcName) {
-    const auto &item = name_to_funcptr_map.find(funcName);
-    if (item != name_to_funcptr_map.end()) {
-        return reinterpret_cast<PFN_vkVoidFunction>(item->second);
+    const InterceptEntry *item = FindIntercept(funcName);
+    if (item && item->funcptr) {
+        return reinterpret_cast<PFN_vkVoidFunction>(item->funcptr);
     }
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     auto &table = layer_data->instance_dispatch_table;
@@ -827,21 +1218,37 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo *pCreat
         wrap_handles = false;
     }
 
+    // The instance does not exist yet, so the hooks are timed against the process-wide profiler directly
+    ChassisProfiler *profiler = GetChassisProfiler(OBJECT_LAYER_DESCRIPTION);
+
     // Init dispatch array and call registration functions
     for (auto intercept : local_object_dispatch) {
+        ChassisProfileScope profile(profiler, InterceptIdPreCallValidateCreateInstance, intercept->container_type);
         intercept->PreCallValidateCreateInstance(pCreateInfo, pAllocator, pInstance);
     }
     for (auto intercept : local_object_dispatch) {
+        ChassisProfileScope profile(profiler, InterceptIdPreCallRecordCreateInstance, intercept->container_type);
         intercept->PreCallRecordCreateInstance(pCreateInfo, pAllocator, pInstance);
     }
 
+    ChassisProfileScope dispatch_profile(profiler, InterceptIdDispatchCreateInstance, LayerObjectTypeInstance);
     VkResult result = fpCreateInstance(pCreateInfo, pAllocator, pInstance);
+    dispatch_profile.End();
     if (result != VK_SUCCESS) return result;
 
     auto framework = GetLayerDataPtr(get_dispatch_key(*pInstance), layer_data_map);
 
     framework->object_dispatch = local_object_dispatch;
+    framework->InitObjectDispatchVectors();
     framework->container_type = LayerObjectTypeInstance;
+    framework->profiler = profiler;
+    auto tracer = GetChassisTracer(OBJECT_LAYER_DESCRIPTION);
+    if (tracer) tracer->AddInstance();
+    auto capture = GetApiCapture(OBJECT_LAYER_DESCRIPTION);
+    if (capture) {
+        capture->AddInstance();
+        CaptureCreateInstance(capture, pCreateInfo, pAllocator, pInstance, result);
+    }
     framework->disabled = local_disables;
     framework->enabled = local_enables;
 
@@ -882,6 +1289,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo *pCreat
 #endif
 
     for (auto intercept : framework->object_dispatch) {
+        ChassisProfileScope profile(profiler, InterceptIdPostCallRecordCreateInstance, intercept->container_type);
         intercept->PostCallRecordCreateInstance(pCreateInfo, pAllocator, pInstance, result);
     }
 
@@ -894,17 +1302,25 @@ VKAPI_ATTR void VKAPI_CALL DestroyInstance(VkInstance instance, const VkAllocati
     dispatch_key key = get_dispatch_key(instance);
     auto layer_data = GetLayerDataPtr(key, layer_data_map);
     """ + precallvalidate_loop + """
+        ChassisProfileScope profile(layer_data->profiler, InterceptIdPreCallValidateDestroyInstance, intercept->container_type);
         auto lock = intercept->write_lock();
         intercept->PreCallValidateDestroyInstance(instance, pAllocator);
     }
     """ + precallrecord_loop + """
+        ChassisProfileScope profile(layer_data->profiler, InterceptIdPreCallRecordDestroyInstance, intercept->container_type);
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroyInstance(instance, pAllocator);
     }
 
+    auto capture = ApiCapture::Active();
+    if (capture) capture->ReserveSequence();
+    ChassisProfileScope dispatch_profile(layer_data->profiler, InterceptIdDispatchDestroyInstance, layer_data->container_type);
     layer_data->instance_dispatch_table.DestroyInstance(instance, pAllocator);
+    dispatch_profile.End();
+    if (capture) CaptureDestroyInstance(capture, instance, pAllocator);
 
     """ + postcallrecord_loop + """
+        ChassisProfileScope profile(layer_data->profiler, InterceptIdPostCallRecordDestroyInstance, intercept->container_type);
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroyInstance(instance, pAllocator);
     }
@@ -922,6 +1338,10 @@ VKAPI_ATTR void VKAPI_CALL DestroyInstance(VkInstance instance, const VkAllocati
 
     layer_debug_utils_destroy_instance(layer_data->report_data);
 
+    if (layer_data->profiler) layer_data->profiler->Dump();
+    auto tracer = GetChassisTracer(OBJECT_LAYER_DESCRIPTION);
+    if (tracer) tracer->RemoveInstance();
+    if (capture) capture->RemoveInstance();
     for (auto item = layer_data->object_dispatch.begin(); item != layer_data->object_dispatch.end(); item++) {
         delete *item;
     }
@@ -959,22 +1379,35 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice gpu, const VkDevice
 
     bool skip = false;
     for (auto intercept : instance_interceptor->object_dispatch) {
+        ChassisProfileScope profile(instance_interceptor->profiler, InterceptIdPreCallValidateCreateDevice,
+                                    intercept->container_type);
         auto lock = intercept->write_lock();
         skip |= intercept->PreCallValidateCreateDevice(gpu, pCreateInfo, pAllocator, pDevice);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : instance_interceptor->object_dispatch) {
+        ChassisProfileScope profile(instance_interceptor->profiler, InterceptIdPreCallRecordCreateDevice, intercept->container_type);
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateDevice(gpu, pCreateInfo, pAllocator, pDevice, modified_create_info);
     }
 
+    ChassisProfileScope dispatch_profile(instance_interceptor->profiler, InterceptIdDispatchCreateDevice,
+                                         instance_interceptor->container_type);
     VkResult result = fpCreateDevice(gpu, reinterpret_cast<VkDeviceCreateInfo *>(modified_create_info.get()), pAllocator, pDevice);
+    dispatch_profile.End();
     if (result != VK_SUCCESS) {
         return result;
     }
 
+    ApiCapture *capture = ApiCapture::Active();
+    if (capture) {
+        CapturePhysicalDeviceState(capture, instance_interceptor, gpu, device_extensions);
+        CaptureCreateDevice(capture, gpu, pCreateInfo, pAllocator, pDevice, result);
+    }
+
     auto device_interceptor = GetLayerDataPtr(get_dispatch_key(*pDevice), layer_data_map);
     device_interceptor->container_type = LayerObjectTypeDevice;
+    device_interceptor->profiler = instance_interceptor->profiler;
 
     // Save local info in device object
     device_interceptor->phys_dev_properties.properties = device_properties;
@@ -1035,8 +1468,17 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice gpu, const VkDevice
         dev_intercept->instance_extensions = instance_interceptor->instance_extensions;
         dev_intercept->device_extensions = device_interceptor->device_extensions;
     }
+    device_interceptor->InitObjectDispatchVectors();
+
+    // GPU-assisted validation inserts commands into command buffers while recording them, so it cannot be deferred
+    uint32_t deferred_validation_threads = GetDeferredValidationThreadCount(OBJECT_LAYER_DESCRIPTION);
+    if (deferred_validation_threads && !instance_interceptor->enabled.gpu_validation) {
+        device_interceptor->deferred_validation.reset(new DeferredValidation(deferred_validation_threads));
+    }
+    device_interceptor->sample_frames = GetSampleFrames(OBJECT_LAYER_DESCRIPTION);
 
     for (auto intercept : instance_interceptor->object_dispatch) {
+        ChassisProfileScope profile(instance_interceptor->profiler, InterceptIdPostCallRecordCreateDevice, intercept->container_type);
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateDevice(gpu, pCreateInfo, pAllocator, pDevice, result);
     }
@@ -1049,23 +1491,35 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice gpu, const VkDevice
 VKAPI_ATTR void VKAPI_CALL DestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator) {
     dispatch_key key = get_dispatch_key(device);
     auto layer_data = GetLayerDataPtr(key, layer_data_map);
+    // Finish any deferred validation before tearing down the state it uses
+    layer_data->deferred_validation.reset();
     """ + precallvalidate_loop + """
+        ChassisProfileScope profile(layer_data->profiler, InterceptIdPreCallValidateDestroyDevice, intercept->container_type);
         auto lock = intercept->write_lock();
         intercept->PreCallValidateDestroyDevice(device, pAllocator);
     }
     """ + precallrecord_loop + """
+        ChassisProfileScope profile(layer_data->profiler, InterceptIdPreCallRecordDestroyDevice, intercept->container_type);
         auto lock = intercept->write_lock();
         intercept->PreCallRecordDestroyDevice(device, pAllocator);
     }
     layer_debug_utils_destroy_device(device);
 
+    auto capture = ApiCapture::Active();
+    if (capture) capture->ReserveSequence();
+    ChassisProfileScope dispatch_profile(layer_data->profiler, InterceptIdDispatchDestroyDevice, layer_data->container_type);
     layer_data->device_dispatch_table.DestroyDevice(device, pAllocator);
+    dispatch_profile.End();
+    if (capture) CaptureDestroyDevice(capture, device, pAllocator);
 
     """ + postcallrecord_loop + """
+        ChassisProfileScope profile(layer_data->profiler, InterceptIdPostCallRecordDestroyDevice, intercept->container_type);
         auto lock = intercept->write_lock();
         intercept->PostCallRecordDestroyDevice(device, pAllocator);
     }
 
+    if (layer_data->profiler) layer_data->profiler->Dump();
+    ReportSuppressedMessages(layer_data->report_data);
     for (auto item = layer_data->object_dispatch.begin(); item != layer_data->object_dispatch.end(); item++) {
         delete *item;
     }
@@ -1095,18 +1549,25 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateGraphicsPipelines(
 #endif
 
     for (auto intercept : layer_data->object_dispatch) {
+        ChassisProfileScope profile(layer_data->profiler, InterceptIdPreCallValidateCreateGraphicsPipelines, intercept->container_type);
         auto lock = intercept->write_lock();
         skip |= intercept->PreCallValidateCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, &cgpl_state);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        ChassisProfileScope profile(layer_data->profiler, InterceptIdPreCallRecordCreateGraphicsPipelines, intercept->container_type);
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, &cgpl_state);
     }
 
+    ChassisProfileScope dispatch_profile(layer_data->profiler, InterceptIdDispatchCreateGraphicsPipelines, layer_data->container_type);
     VkResult result = DispatchCreateGraphicsPipelines(device, pipelineCache, createInfoCount, cgpl_state.pCreateInfos, pAllocator, pPipelines);
+    dispatch_profile.End();
+    ApiCapture *capture = ApiCapture::Active();
+    if (capture) CaptureCreateGraphicsPipelines(capture, device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, result);
 
     for (auto intercept : layer_data->object_dispatch) {
+        ChassisProfileScope profile(layer_data->profiler, InterceptIdPostCallRecordCreateGraphicsPipelines, intercept->container_type);
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, result, &cgpl_state);
     }
@@ -1131,16 +1592,23 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateComputePipelines(
     std::vector<std::unique_ptr<PIPELINE_STATE>> pipe_state;
 
     for (auto intercept : layer_data->object_dispatch) {
+        ChassisProfileScope profile(layer_data->profiler, InterceptIdPreCallValidateCreateComputePipelines, intercept->container_type);
         auto lock = intercept->write_lock();
         skip |= intercept->PreCallValidateCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, &pipe_state);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        ChassisProfileScope profile(layer_data->profiler, InterceptIdPreCallRecordCreateComputePipelines, intercept->container_type);
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
     }
+    ChassisProfileScope dispatch_profile(layer_data->profiler, InterceptIdDispatchCreateComputePipelines, layer_data->container_type);
     VkResult result = DispatchCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+    dispatch_profile.End();
+    ApiCapture *capture = ApiCapture::Active();
+    if (capture) CaptureCreateComputePipelines(capture, device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, result);
     for (auto intercept : layer_data->object_dispatch) {
+        ChassisProfileScope profile(layer_data->profiler, InterceptIdPostCallRecordCreateComputePipelines, intercept->container_type);
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, result, &pipe_state);
     }
@@ -1164,16 +1632,23 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRayTracingPipelinesNV(
     std::vector<std::unique_ptr<PIPELINE_STATE>> pipe_state;
 
     for (auto intercept : layer_data->object_dispatch) {
+        ChassisProfileScope profile(layer_data->profiler, InterceptIdPreCallValidateCreateRayTracingPipelinesNV, intercept->container_type);
         auto lock = intercept->write_lock();
         skip |= intercept->PreCallValidateCreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, &pipe_state);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        ChassisProfileScope profile(layer_data->profiler, InterceptIdPreCallRecordCreateRayTracingPipelinesNV, intercept->container_type);
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
     }
+    ChassisProfileScope dispatch_profile(layer_data->profiler, InterceptIdDispatchCreateRayTracingPipelinesNV, layer_data->container_type);
     VkResult result = DispatchCreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+    dispatch_profile.End();
+    ApiCapture *capture = ApiCapture::Active();
+    if (capture) CaptureCreateRayTracingPipelinesNV(capture, device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, result);
     for (auto intercept : layer_data->object_dispatch) {
+        ChassisProfileScope profile(layer_data->profiler, InterceptIdPostCallRecordCreateRayTracingPipelinesNV, intercept->container_type);
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines, result, &pipe_state);
     }
@@ -1198,16 +1673,23 @@ VKAPI_ATTR VkResult VKAPI_CALL CreatePipelineLayout(
     cpl_state.modified_create_info = *pCreateInfo;
 
     for (auto intercept : layer_data->object_dispatch) {
+        ChassisProfileScope profile(layer_data->profiler, InterceptIdPreCallValidateCreatePipelineLayout, intercept->container_type);
         auto lock = intercept->write_lock();
         skip |= intercept->PreCallValidateCreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        ChassisProfileScope profile(layer_data->profiler, InterceptIdPreCallRecordCreatePipelineLayout, intercept->container_type);
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout, &cpl_state);
     }
+    ChassisProfileScope dispatch_profile(layer_data->profiler, InterceptIdDispatchCreatePipelineLayout, layer_data->container_type);
     VkResult result = DispatchCreatePipelineLayout(device, &cpl_state.modified_create_info, pAllocator, pPipelineLayout);
+    dispatch_profile.End();
+    ApiCapture *capture = ApiCapture::Active();
+    if (capture) CaptureCreatePipelineLayout(capture, device, pCreateInfo, pAllocator, pPipelineLayout, result);
     for (auto intercept : layer_data->object_dispatch) {
+        ChassisProfileScope profile(layer_data->profiler, InterceptIdPostCallRecordCreatePipelineLayout, intercept->container_type);
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout, result);
     }
@@ -1232,16 +1714,23 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateShaderModule(
     csm_state.instrumented_create_info = *pCreateInfo;
 
     for (auto intercept : layer_data->object_dispatch) {
+        ChassisProfileScope profile(layer_data->profiler, InterceptIdPreCallValidateCreateShaderModule, intercept->container_type);
         auto lock = intercept->write_lock();
         skip |= intercept->PreCallValidateCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule, &csm_state);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        ChassisProfileScope profile(layer_data->profiler, InterceptIdPreCallRecordCreateShaderModule, intercept->container_type);
         auto lock = intercept->write_lock();
         intercept->PreCallRecordCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule, &csm_state);
     }
+    ChassisProfileScope dispatch_profile(layer_data->profiler, InterceptIdDispatchCreateShaderModule, layer_data->container_type);
     VkResult result = DispatchCreateShaderModule(device, &csm_state.instrumented_create_info, pAllocator, pShaderModule);
+    dispatch_profile.End();
+    ApiCapture *capture = ApiCapture::Active();
+    if (capture) CaptureCreateShaderModule(capture, device, pCreateInfo, pAllocator, pShaderModule, result);
     for (auto intercept : layer_data->object_dispatch) {
+        ChassisProfileScope profile(layer_data->profiler, InterceptIdPostCallRecordCreateShaderModule, intercept->container_type);
         auto lock = intercept->write_lock();
         intercept->PostCallRecordCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule, result, &csm_state);
     }
@@ -1262,16 +1751,23 @@ VKAPI_ATTR VkResult VKAPI_CALL AllocateDescriptorSets(
 #endif
 
     for (auto intercept : layer_data->object_dispatch) {
+        ChassisProfileScope profile(layer_data->profiler, InterceptIdPreCallValidateAllocateDescriptorSets, intercept->container_type);
         auto lock = intercept->write_lock();
         skip |= intercept->PreCallValidateAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets, &ads_state);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
     for (auto intercept : layer_data->object_dispatch) {
+        ChassisProfileScope profile(layer_data->profiler, InterceptIdPreCallRecordAllocateDescriptorSets, intercept->container_type);
         auto lock = intercept->write_lock();
         intercept->PreCallRecordAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets);
     }
+    ChassisProfileScope dispatch_profile(layer_data->profiler, InterceptIdDispatchAllocateDescriptorSets, layer_data->container_type);
     VkResult result = DispatchAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets);
+    dispatch_profile.End();
+    ApiCapture *capture = ApiCapture::Active();
+    if (capture) CaptureAllocateDescriptorSets(capture, device, pAllocateInfo, pDescriptorSets, result);
     for (auto intercept : layer_data->object_dispatch) {
+        ChassisProfileScope profile(layer_data->profiler, InterceptIdPostCallRecordAllocateDescriptorSets, intercept->container_type);
         auto lock = intercept->write_lock();
         intercept->PostCallRecordAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets, result, &ads_state);
     }
@@ -1409,6 +1905,74 @@ VKAPI_ATTR VkResult VKAPI_CALL GetValidationCacheDataEXT(
         };
 """
 
+    inline_custom_source_dispatch_vector_preamble = """
+// A validation object is only placed in the dispatch vector for a hook if its class overrides the ValidationObject default.
+// The address of an inherited member keeps the base class type, so this is resolved entirely at compile time. Hooks can be
+// overloaded, so the class is deduced from the overload with the exact hook signature rather than from the member's type.
+template <typename Signature>
+struct HookDeclaringClass;
+template <typename R, typename... Args>
+struct HookDeclaringClass<R(Args...)> {
+    template <typename C>
+    static C *Of(R (C::*)(Args...));
+};
+#define VALIDATION_OBJECT_OVERRIDES(type, name, signature) \
+    (!std::is_same<decltype(HookDeclaringClass<signature>::Of(&type::name)), ValidationObject *>::value)
+#if BUILD_THREAD_SAFETY
+#define THREAD_SAFETY_OVERRIDES(name, signature) VALIDATION_OBJECT_OVERRIDES(ThreadSafety, name, signature)
+#else
+#define THREAD_SAFETY_OVERRIDES(name, signature) false
+#endif
+#if BUILD_PARAMETER_VALIDATION
+#define STATELESS_VALIDATION_OVERRIDES(name, signature) VALIDATION_OBJECT_OVERRIDES(StatelessValidation, name, signature)
+#else
+#define STATELESS_VALIDATION_OVERRIDES(name, signature) false
+#endif
+#if BUILD_OBJECT_TRACKER
+#define OBJECT_LIFETIMES_OVERRIDES(name, signature) VALIDATION_OBJECT_OVERRIDES(ObjectLifetimes, name, signature)
+#else
+#define OBJECT_LIFETIMES_OVERRIDES(name, signature) false
+#endif
+#if BUILD_CORE_VALIDATION
+#define CORE_CHECKS_OVERRIDES(name, signature) VALIDATION_OBJECT_OVERRIDES(CoreChecks, name, signature)
+#else
+#define CORE_CHECKS_OVERRIDES(name, signature) false
+#endif
+
+#define BUILD_DISPATCH_VECTOR(name, signature)                                                                                \\
+    init_object_dispatch_vector(InterceptId##name, THREAD_SAFETY_OVERRIDES(name, signature),                                  \\
+                                STATELESS_VALIDATION_OVERRIDES(name, signature), OBJECT_LIFETIMES_OVERRIDES(name, signature), \\
+                                CORE_CHECKS_OVERRIDES(name, signature))
+
+void ValidationObject::InitObjectDispatchVectors() {
+    auto init_object_dispatch_vector = [this](InterceptId id, bool thread_safety, bool stateless_validation,
+                                              bool object_lifetimes, bool core_checks) {
+        auto &intercept_vector = this->intercept_vectors[id];
+        for (auto item : this->object_dispatch) {
+            switch (item->container_type) {
+                case LayerObjectTypeThreading:
+                    if (thread_safety) intercept_vector.push_back(item);
+                    break;
+                case LayerObjectTypeParameterValidation:
+                    if (stateless_validation) intercept_vector.push_back(item);
+                    break;
+                case LayerObjectTypeObjectTracker:
+                    if (object_lifetimes) intercept_vector.push_back(item);
+                    break;
+                case LayerObjectTypeCoreValidation:
+                    if (core_checks) intercept_vector.push_back(item);
+                    break;
+                default:
+                    // Chassis codegen needs to be updated for unknown validation object type
+                    assert(0);
+            }
+        }
+    };
+
+    intercept_vectors.clear();
+    intercept_vectors.resize(InterceptIdCount);
+"""
+
     inline_custom_source_postamble = """
 // loader-layer interface v0, just wrappers since there is only a layer
 
@@ -1457,6 +2021,13 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
     }
 
     return VK_SUCCESS;
+}
+
+// Writes the profiler totals so far to the profile output file, for applications that want results before teardown. Does
+// nothing unless profile_output is set.
+VK_LAYER_EXPORT VKAPI_ATTR void VKAPI_CALL vkLayerDumpProfile() {
+    ChassisProfiler *profiler = vulkan_layer_chassis::GetChassisProfiler(OBJECT_LAYER_DESCRIPTION);
+    if (profiler) profiler->Dump();
 }"""
 
 
@@ -1467,8 +2038,20 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
         OutputGenerator.__init__(self, errFile, warnFile, diagFile)
         # Internal state - accumulators for different inner block text
         self.sections = dict([(section, []) for section in self.ALL_SECTIONS])
-        self.intercepts = []
+        self.intercepts = []                        # (name, protect, device extension) of each intercepted command
+        self.intercept_ids = []                     # InterceptId enumerants, one per generated pre/post call hook
+        self.dispatch_vectors = []                  # BUILD_DISPATCH_VECTOR invocations, one per generated hook
+        self.intercept_names = []                   # Hook name strings, in InterceptId order
         self.layer_factory = ''                     # String containing base layer factory class definition
+        self.capture_ids = []                       # CaptureId enumerants, one per captured command
+        self.capture_names = []                     # Captured command name strings, in CaptureId order
+        self.capture_decls = []                     # Declarations of the generated per-command capture functions
+        self.capture_pnext_cases = []               # CaptureEncodePNext cases, one per struct with an sType
+        self.capture_raw_types = {}                 # Memoized captureIsRaw results
+        self.replay_pnext_cases = []                # CaptureDecodePNext cases, one per struct with an sType
+        self.replay_size_cases = []                 # CaptureStructureSize cases, one per struct with an sType
+        self.replay_functions = []                  # replay_functions entries, in CaptureId order
+        self.replay_stubs = []                      # replay_stub_functions entries, one per command
 
     # Check if the parameter passed in is a pointer to an array
     def paramIsArray(self, param):
@@ -1505,12 +2088,15 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
         write(self.inline_copyright_message, file=self.outFile)
         # Multiple inclusion protection
         self.header = False
+        self.replay = genOpts.helper_file_type == 'layer_chassis_replay'
         if (self.genOpts.filename and 'h' == self.genOpts.filename[-1]):
             self.header = True
             write('#pragma once', file=self.outFile)
             self.newline()
         if self.header:
             write(self.inline_custom_header_preamble, file=self.outFile)
+        elif self.replay:
+            write(self.inline_custom_replay_preamble, file=self.outFile)
         else:
             write(self.inline_custom_source_preamble, file=self.outFile)
         self.layer_factory += self.inline_custom_header_class_definition
@@ -1519,20 +2105,101 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
     def endFile(self):
         # Finish C++ namespace and multiple inclusion protection
         self.newline()
+        if self.replay:
+            write('// Decodes a pNext chain captured by CaptureEncodePNext. Structure types that this build does not know fail the record.', file=self.outFile)
+            write('void *CaptureDecodePNext(ApiCaptureDecoder &decoder) {', file=self.outFile)
+            write('    switch (decoder.PeekStructureType()) {', file=self.outFile)
+            write('\n'.join(self.replay_pnext_cases), file=self.outFile)
+            write('        default:', file=self.outFile)
+            write('            break;', file=self.outFile)
+            write('    }', file=self.outFile)
+            write('    if (decoder.Read<VkStructureType>() != VK_STRUCTURE_TYPE_MAX_ENUM) decoder.Fail();', file=self.outFile)
+            write('    return nullptr;', file=self.outFile)
+            write('}', file=self.outFile)
+            self.newline()
+            write('size_t CaptureStructureSize(VkStructureType type) {', file=self.outFile)
+            write('    switch (type) {', file=self.outFile)
+            write('\n'.join(self.replay_size_cases), file=self.outFile)
+            write('        default:', file=self.outFile)
+            write('            return 0;', file=self.outFile)
+            write('    }', file=self.outFile)
+            write('}', file=self.outFile)
+            self.newline()
+            write('// Replay functions indexed by CaptureId. Physical device state records are read before the replay starts.', file=self.outFile)
+            write('const ReplayFunction replay_functions[] = {', file=self.outFile)
+            write('\n'.join(self.replay_functions), file=self.outFile)
+            write('    nullptr,', file=self.outFile)
+            write('};', file=self.outFile)
+            self.newline()
+            write('// Down-chain stubs by command name, which the stub vkGetInstanceProcAddr and vkGetDeviceProcAddr return', file=self.outFile)
+            write('const std::unordered_map<std::string, PFN_vkVoidFunction> replay_stub_functions = {', file=self.outFile)
+            write('\n'.join(self.replay_stubs), file=self.outFile)
+            write('};', file=self.outFile)
+            self.newline()
+            write('} // namespace vulkan_layer_replay', file=self.outFile)
+            OutputGenerator.endFile(self)
+            return
         if not self.header:
             # Record intercepted procedures
-            write('// Map of all APIs to be intercepted by this layer', file=self.outFile)
-            write('const std::unordered_map<std::string, void*> name_to_funcptr_map = {', file=self.outFile)
-            write('\n'.join(self.intercepts), file=self.outFile)
-            write('};\n', file=self.outFile)
+            write('// Captures a pNext chain as the first structure in it that the registry defines, which in turn captures its own', file=self.outFile)
+            write('// pNext. VK_STRUCTURE_TYPE_MAX_ENUM ends the chain. Other structures, such as those of the loader, are left out.', file=self.outFile)
+            write('void CaptureEncodePNext(ApiCaptureEncoder &encoder, const void *next) {', file=self.outFile)
+            write('    for (auto header = static_cast<const VkBaseInStructure *>(next); header; header = header->pNext) {', file=self.outFile)
+            write('        switch (header->sType) {', file=self.outFile)
+            write('\n'.join(self.capture_pnext_cases), file=self.outFile)
+            write('            default:', file=self.outFile)
+            write('                break;', file=self.outFile)
+            write('        }', file=self.outFile)
+            write('    }', file=self.outFile)
+            write('    encoder.Value(VK_STRUCTURE_TYPE_MAX_ENUM);', file=self.outFile)
+            write('}', file=self.outFile)
             self.newline()
+            self.writeInterceptTable()
             write('} // namespace vulkan_layer_chassis', file=self.outFile)
+            # Build the per-hook dispatch vectors
+            write(self.inline_custom_source_dispatch_vector_preamble, file=self.outFile)
+            write('\n'.join(self.dispatch_vectors), file=self.outFile)
+            write('}', file=self.outFile)
+            self.newline()
+            write('// Hook names indexed by InterceptId, for profiler output', file=self.outFile)
+            write('const char *const intercept_id_names[] = {', file=self.outFile)
+            write('\n'.join(self.intercept_names), file=self.outFile)
+            write('};', file=self.outFile)
+            self.newline()
+            write('// Command names indexed by CaptureId, for the API capture file header', file=self.outFile)
+            write('const char *const capture_id_names[] = {', file=self.outFile)
+            write('\n'.join(self.capture_names), file=self.outFile)
+            write('    "PhysicalDeviceState",', file=self.outFile)
+            write('};', file=self.outFile)
+            self.newline()
         if self.header:
             self.newline()
             # Output Layer Factory Class Definitions
             self.layer_factory += self.inline_custom_validation_class_definitions
             self.layer_factory += '};\n\n'
-            self.layer_factory += 'extern std::unordered_map<void*, ValidationObject*> layer_data_map;'
+            self.layer_factory += 'extern layer_data_table<ValidationObject> layer_data_map;'
+            # Index into ValidationObject::intercept_vectors for each generated hook
+            write('// Layer chassis intercept identifiers, used to index the per-hook dispatch vectors', file=self.outFile)
+            write('typedef enum InterceptId {', file=self.outFile)
+            write('\n'.join(self.intercept_ids), file=self.outFile)
+            write('    InterceptIdCount,', file=self.outFile)
+            write('} InterceptId;', file=self.outFile)
+            write('extern const char *const intercept_id_names[];', file=self.outFile)
+            self.newline()
+            # Index into capture_id_names for each captured command
+            write('// API capture command identifiers, recorded in each call record of a capture file', file=self.outFile)
+            write('typedef enum CaptureId {', file=self.outFile)
+            write('\n'.join(self.capture_ids), file=self.outFile)
+            write('    CaptureIdPhysicalDeviceState,', file=self.outFile)
+            write('    CaptureIdCount,', file=self.outFile)
+            write('} CaptureId;', file=self.outFile)
+            write('extern const char *const capture_id_names[];', file=self.outFile)
+            self.newline()
+            write('namespace vulkan_layer_chassis {', file=self.outFile)
+            write('// Per-command API capture functions, called once the command has returned', file=self.outFile)
+            write('\n'.join(self.capture_decls), file=self.outFile)
+            write('} // namespace vulkan_layer_chassis', file=self.outFile)
+            self.newline()
             write(self.layer_factory, file=self.outFile)
         else:
             write(self.inline_custom_source_postamble, file=self.outFile)
@@ -1575,7 +2242,13 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
     #
     # Type generation
     def genType(self, typeinfo, name, alias):
-        pass
+        if self.header or alias is not None:
+            return
+        if typeinfo.elem.get('category') in ['struct', 'union'] and not self.captureIsRaw(name):
+            if self.replay:
+                self.genCaptureDecoder(typeinfo.elem, name)
+            else:
+                self.genCaptureEncoder(typeinfo.elem, name)
     #
     # Struct (e.g. C "struct" type) generation. This is a special case of the <type> tag where the contents are
     # interpreted as a set of <member> tags instead of freeform C type declarations. The <member> tags are just like <param>
@@ -1618,6 +2291,566 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
             post_call_record = post_call_record.replace(')', ', VkResult result)')
         return '        %s\n        %s\n        %s\n' % (pre_call_validate, pre_call_record, post_call_record)
     #
+    # Record the InterceptId enumerants (header) or dispatch vector initializers (source) for a generated intercept
+    # Manual intercepts get identifiers for profiling, but no dispatch vectors: they walk object_dispatch themselves
+    def recordInterceptHooks(self, cmdinfo, name, dispatch_vectors=True):
+        params = [self.makeCParamDecl(param, 0).strip() for param in cmdinfo.elem.findall('param')]
+        post_params = params + ['VkResult result'] if cmdinfo.elem.find('proto/type').text == 'VkResult' else params
+        # Each hook with the function type of its exact signature, which picks it out among overloads of the same name
+        hooks = [('PreCallValidate' + name[2:], 'bool(%s)' % ', '.join(params)),
+                 ('PreCallRecord' + name[2:], 'void(%s)' % ', '.join(params)),
+                 ('PostCallRecord' + name[2:], 'void(%s)' % ', '.join(post_params))]
+        # The down-chain call is profiled under an identifier of its own
+        ids = [hook for hook, signature in hooks] + ['Dispatch' + name[2:]]
+        if self.header:
+            targets = [(self.intercept_ids, ['    InterceptId%s,' % id for id in ids])]
+        else:
+            targets = [(self.intercept_names, ['    "%s",' % id for id in ids])]
+            if dispatch_vectors:
+                targets.append((self.dispatch_vectors, ['    BUILD_DISPATCH_VECTOR(%s, %s);' % hook for hook in hooks]))
+        for target, lines in targets:
+            if (self.featureExtraProtect != None):
+                target.append('#ifdef %s' % self.featureExtraProtect)
+            target.extend(lines)
+            if (self.featureExtraProtect != None):
+                target.append('#endif')
+    #
+    # Registry definition of a struct or union type, or None for other types and for aliases
+    def structType(self, type_name):
+        type_elem = self.registry.tree.find("types/type[@name='%s']" % type_name)
+        if type_elem is None or type_elem.get('category') not in ['struct', 'union'] or type_elem.get('alias') is not None:
+            return None
+        return type_elem
+    #
+    # True if a struct has a safe_struct helper, i.e. it has an sType or one of its members is a pointer
+    def hasSafeStruct(self, struct_elem):
+        for member in struct_elem.findall('member'):
+            if member.find('name').text == 'sType' or '*' in ''.join(member.itertext()):
+                return True
+        return False
+    #
+    # True if a struct holds no pointers, directly or through nested structs, and so can be copied by value
+    def isPlainStruct(self, struct_elem):
+        for member in struct_elem.findall('member'):
+            nested = self.structType(member.find('type').text)
+            if nested is not None and (self.hasSafeStruct(nested) or not self.isPlainStruct(nested)):
+                return False
+        return not self.hasSafeStruct(struct_elem)
+    #
+    # Copy the parameters of a deferred call so that its hooks can run on a worker thread after the application has reused
+    # its memory. Returns (copy statements, lambda captures, hook arguments), or None if a parameter cannot be copied.
+    def captureParams(self, cmdinfo):
+        param_names = [param.find('name').text for param in cmdinfo.elem.findall('param')]
+        copies = []
+        captures = ['layer_data']
+        args = []
+        for param in cmdinfo.elem.findall('param'):
+            type_name = param.find('type').text
+            name = param.find('name').text
+            text = ''.join(param.itertext())
+            local = 'local_%s' % name
+            pointer_depth = text.count('*')
+            fixed_size = re.search(r'\[(\w+)\]', text)
+            struct_elem = self.structType(type_name)
+            if struct_elem is not None and not self.hasSafeStruct(struct_elem) and not self.isPlainStruct(struct_elem):
+                return None
+            if fixed_size is not None:
+                copies.append('std::array<%s, %s> %s;' % (type_name, fixed_size.group(1), local))
+                copies.append('std::copy(%s, %s + %s, %s.begin());' % (name, name, fixed_size.group(1), local))
+                captures.append('%s = std::move(%s)' % (local, local))
+                args.append('%s.data()' % local)
+                continue
+            if pointer_depth == 0:
+                captures.append(name)
+                args.append(name)
+                continue
+            if pointer_depth > 1 or not text.startswith('const') or type_name == 'char':
+                return None
+            length = param.get('len')
+            if length is None:
+                if type_name == 'void':
+                    return None
+                if struct_elem is not None and self.hasSafeStruct(struct_elem):
+                    copies.append('safe_%s %s;' % (type_name, local))
+                    copies.append('if (%s) %s.initialize(%s);' % (name, local, name))
+                    args.append('%s ? %s.ptr() : nullptr' % (name, local))
+                else:
+                    copies.append('%s %s = {};' % (type_name, local))
+                    copies.append('if (%s) %s = *%s;' % (name, local, name))
+                    args.append('%s ? &%s : nullptr' % (name, local))
+            else:
+                if length not in param_names:
+                    return None
+                if type_name == 'void':
+                    copies.append('std::vector<uint8_t> %s;' % local)
+                    copies.append('if (%s) %s.assign(static_cast<const uint8_t *>(%s), static_cast<const uint8_t *>(%s) + %s);' % (name, local, name, name, length))
+                    args.append('%s ? %s.data() : nullptr' % (name, local))
+                elif struct_elem is not None and self.hasSafeStruct(struct_elem):
+                    copies.append('std::vector<safe_%s> %s;' % (type_name, local))
+                    copies.append('if (%s) {' % name)
+                    copies.append('    %s.reserve(%s);' % (local, length))
+                    copies.append('    for (uint32_t index = 0; index < %s; ++index) %s.emplace_back(&%s[index]);' % (length, local, name))
+                    copies.append('}')
+                    args.append('%s ? reinterpret_cast<const %s *>(%s.data()) : nullptr' % (name, type_name, local))
+                else:
+                    copies.append('std::vector<%s> %s;' % (type_name, local))
+                    copies.append('if (%s) %s.assign(%s, %s + %s);' % (name, local, name, name, length))
+                    args.append('%s ? %s.data() : nullptr' % (name, local))
+            # The original pointer is only captured to preserve whether the application passed null
+            captures.append(name)
+            captures.append('%s = std::move(%s)' % (local, local))
+        return (copies, captures, args)
+    #
+    # Registry definition of a type; handles and function pointers are named by a child element rather than an attribute
+    def registryType(self, type_name):
+        type_elem = self.registry.tree.find("types/type[@name='%s']" % type_name)
+        if type_elem is None:
+            type_elem = self.registry.tree.find("types/type/[name='%s']" % type_name)
+        return type_elem
+    #
+    # True if values of a type can be captured as their bytes: scalars, and structs or unions without pointers or dispatchable
+    # handles. Unions are always captured as their bytes.
+    def captureIsRaw(self, type_name):
+        if type_name in self.capture_raw_types:
+            return self.capture_raw_types[type_name]
+        raw = True
+        type_elem = self.registryType(type_name)
+        if type_elem is not None and type_elem.get('alias') is not None:
+            raw = self.captureIsRaw(type_elem.get('alias'))
+        elif type_elem is not None and type_elem.get('category') == 'funcpointer':
+            raw = False
+        elif type_elem is not None and type_elem.get('category') == 'struct':
+            for member in type_elem.findall('member'):
+                member_type = member.find('type').text
+                if member.find('name').text == 'sType' or '*' in ''.join(member.itertext()):
+                    raw = False
+                elif self.isHandleTypeDispatchable(member_type) or not self.captureIsRaw(member_type):
+                    raw = False
+        self.capture_raw_types[type_name] = raw
+        return raw
+    #
+    # True for the platform types that pointers may refer to, such as Display or ANativeWindow, whose contents are not captured
+    def captureIsOpaque(self, type_name):
+        type_elem = self.registryType(type_name)
+        if type_elem is None:
+            return True
+        if type_elem.get('category') is None:
+            return type_elem.get('requires') not in [None, 'vk_platform']
+        return type_elem.get('category') == 'struct' and not type_elem.findall('member')
+    #
+    # Statement capturing a single value of a type
+    def captureValue(self, type_name, value):
+        if self.isHandleTypeDispatchable(type_name) or self.isHandleTypeNonDispatchable(type_name):
+            return 'encoder.Value(HandleToUint64(%s));' % value
+        type_elem = self.registryType(type_name)
+        if type_elem is not None and type_elem.get('category') == 'funcpointer':
+            return 'encoder.Address(%s);' % value
+        if self.captureIsRaw(type_name):
+            return 'encoder.Value(%s);' % value
+        return 'CaptureEncode(encoder, %s);' % value
+    #
+    # Element count expression of an array member or parameter, or None if it cannot be worked out
+    def captureCount(self, elem, prefix, siblings):
+        length = elem.get('len').split(',')[0]
+        if length.startswith('latexmath'):
+            altlen = elem.get('altlen')
+            if altlen is None:
+                return None
+            return re.sub(r'\b([A-Za-z_]\w*)\b', lambda match: prefix + match.group(1) if match.group(1) in siblings else match.group(1), altlen)
+        if '->' in length:
+            base = length.split('->')[0]
+            if base not in siblings:
+                return None
+            return '(%s%s ? %s%s : 0)' % (prefix, base, prefix, length)
+        if length not in siblings:
+            return None
+        if siblings[length]:
+            return '(%s%s ? *%s%s : 0)' % (prefix, length, prefix, length)
+        return prefix + length
+    #
+    # Statements capturing one struct member or command parameter. prefix is prepended to member names, siblings maps the
+    # names of the other members or parameters, which array lengths refer to, to whether they are pointers, and size, if set,
+    # is the size in bytes of untyped data.
+    def captureStatements(self, elem, owner, prefix, siblings, size=None):
+        type_name = elem.find('type').text
+        name = elem.find('name').text
+        text = ''.join(elem.itertext())
+        value = prefix + name
+        pointer_depth = text.count('*')
+        fixed_size = re.findall(r'\[(\w+)\]', text)
+        pointer = value
+        condition = self.capture_pointer_conditions.get((owner, name))
+        if condition is not None:
+            pointer = '%s ? %s : nullptr' % (condition, value)
+        if name == 'pNext' and pointer_depth == 1:
+            return ['CaptureEncodePNext(encoder, %s);' % value]
+        if fixed_size:
+            if len(fixed_size) > 1 or self.captureIsRaw(type_name) and not self.isHandleTypeDispatchable(type_name):
+                return ['encoder.Bytes(%s, sizeof(%s));' % (value, value)]
+            return ['for (uint32_t index = 0; index < %s; ++index) %s' % (fixed_size[0], self.captureValue(type_name, '%s[index]' % value))]
+        if pointer_depth == 0:
+            return [self.captureValue(type_name, value)]
+        if size is not None:
+            return ['encoder.Blob(%s, %s);' % (value, size)]
+        if type_name == 'char' and pointer_depth == 1:
+            return ['encoder.String(%s);' % pointer]
+        if self.captureIsOpaque(type_name) and type_name != 'void':
+            return ['encoder.Address(%s);' % value]
+        length = elem.get('len')
+        if length is not None and length != 'null-terminated':
+            count = self.captureCount(elem, prefix, siblings)
+            if count is None:
+                return ['encoder.Address(%s);' % value]
+            if type_name == 'void' and pointer_depth == 1:
+                return ['encoder.Blob(%s, %s);' % (pointer, count)]
+            if pointer_depth == 1 and self.captureIsRaw(type_name) and not self.isHandleTypeDispatchable(type_name):
+                return ['encoder.Array(%s, %s);' % (pointer, count)]
+            if pointer_depth == 1:
+                element = self.captureValue(type_name, '%s[index]' % value)
+            elif type_name == 'char' and pointer_depth == 2:
+                element = 'encoder.String(%s[index]);' % value
+            else:
+                return ['encoder.Address(%s);' % value]
+            return ['if (encoder.Pointer(%s)) {' % pointer,
+                    '    const uint64_t count = %s;' % count,
+                    '    encoder.Count(count);',
+                    '    for (uint64_t index = 0; index < count; ++index) %s' % element,
+                    '}']
+        if type_name == 'void' and pointer_depth == 2:
+            return ['encoder.Address(%s ? *%s : nullptr);' % (value, value)]
+        if type_name == 'void' or pointer_depth > 1:
+            return ['encoder.Address(%s);' % value]
+        return ['if (encoder.Pointer(%s)) %s' % (pointer, self.captureValue(type_name, '*%s' % value))]
+    #
+    # Capture encoder of a struct that cannot be written as its bytes. Structs with an sType can also appear in pNext chains.
+    def genCaptureEncoder(self, struct_elem, name):
+        members = struct_elem.findall('member')
+        siblings = dict([(member.find('name').text, '*' in ''.join(member.itertext())) for member in members])
+        encoder = ['void CaptureEncode(ApiCaptureEncoder &encoder, const %s &value) {' % name]
+        for member in members:
+            encoder.extend(['    ' + line for line in self.captureStatements(member, name, 'value.', siblings)])
+        encoder.append('}')
+        self.appendSection('struct', '\n'.join(encoder))
+        stype = members[0].get('values') if members and members[0].find('name').text == 'sType' else None
+        if stype is not None:
+            if (self.featureExtraProtect != None):
+                self.capture_pnext_cases.append('#ifdef %s' % self.featureExtraProtect)
+            self.capture_pnext_cases.append('            case %s:' % stype)
+            self.capture_pnext_cases.append('                CaptureEncode(encoder, *reinterpret_cast<const %s *>(header));' % name)
+            self.capture_pnext_cases.append('                return;')
+            if (self.featureExtraProtect != None):
+                self.capture_pnext_cases.append('#endif')
+    #
+    # Capture function of a command, which records its parameters, including the outputs, and its result once it has returned
+    def genCaptureFunction(self, cmdinfo, name):
+        params = cmdinfo.elem.findall('param')
+        resulttype = cmdinfo.elem.find('proto/type').text
+        decls = ['ApiCapture *capture'] + [self.makeCParamDecl(param, 0).strip() for param in params]
+        if resulttype != 'void':
+            decls.append('%s result' % resulttype)
+        prototype = 'void Capture%s(%s)' % (name[2:], ', '.join(decls))
+        if self.header:
+            if (self.featureExtraProtect != None):
+                for target in [self.capture_ids, self.capture_decls]:
+                    target.append('#ifdef %s' % self.featureExtraProtect)
+            self.capture_ids.append('    CaptureId%s,' % name[2:])
+            self.capture_decls.append('%s;' % prototype)
+            if (self.featureExtraProtect != None):
+                for target in [self.capture_ids, self.capture_decls]:
+                    target.append('#endif')
+            return
+        if (self.featureExtraProtect != None):
+            self.capture_names.append('#ifdef %s' % self.featureExtraProtect)
+        self.capture_names.append('    "%s",' % name)
+        if (self.featureExtraProtect != None):
+            self.capture_names.append('#endif')
+        siblings = dict([(param.find('name').text, '*' in ''.join(param.itertext())) for param in params])
+        self.appendSection('command', '')
+        self.appendSection('command', '%s {' % prototype)
+        self.appendSection('command', '    ApiCaptureEncoder &encoder = capture->BeginRecord();')
+        for param in params:
+            size = self.capture_param_sizes.get((name, param.find('name').text))
+            for line in self.captureStatements(param, name, '', siblings, size):
+                self.appendSection('command', '    ' + line)
+        if resulttype != 'void':
+            self.appendSection('command', '    encoder.Value(result);')
+        self.appendSection('command', '    capture->Record(CaptureId%s, encoder);' % name[2:])
+        if name in self.capture_post_statements:
+            self.appendSection('command', '    %s' % self.capture_post_statements[name])
+        self.appendSection('command', '}')
+    #
+    # Statement decoding a single value of a type, the reverse of captureValue
+    def replayValue(self, type_name, value):
+        if self.isHandleTypeDispatchable(type_name):
+            return 'decoder.Dispatchable(%s);' % value
+        if self.isHandleTypeNonDispatchable(type_name):
+            return 'decoder.Handle(%s);' % value
+        type_elem = self.registryType(type_name)
+        if type_elem is not None and type_elem.get('category') == 'funcpointer':
+            return 'decoder.Address(%s);' % value
+        if self.captureIsRaw(type_name):
+            return 'decoder.Value(%s);' % value
+        return 'CaptureDecode(decoder, %s);' % value
+    #
+    # Statements decoding one struct member or command parameter, the reverse of captureStatements. Pointers are set to copies
+    # that the decoder allocates.
+    def replayStatements(self, elem, prefix, siblings, size=None):
+        type_name = elem.find('type').text
+        name = elem.find('name').text
+        text = ''.join(elem.itertext())
+        value = prefix + name
+        pointer_depth = text.count('*')
+        fixed_size = re.findall(r'\[(\w+)\]', text)
+        if name == 'pNext' and pointer_depth == 1:
+            return ['%s = CaptureDecodePNext(decoder);' % value]
+        if fixed_size:
+            if len(fixed_size) > 1 or self.captureIsRaw(type_name) and not self.isHandleTypeDispatchable(type_name):
+                return ['decoder.Bytes(%s, sizeof(%s));' % (value, value)]
+            return ['for (uint32_t index = 0; index < %s; ++index) %s' % (fixed_size[0], self.replayValue(type_name, '%s[index]' % value))]
+        if pointer_depth == 0:
+            return [self.replayValue(type_name, value)]
+        if size is not None:
+            return ['decoder.Blob(%s);' % value]
+        if type_name == 'char' and pointer_depth == 1:
+            return ['%s = decoder.String();' % value]
+        if self.captureIsOpaque(type_name) and type_name != 'void':
+            return ['decoder.Address(%s);' % value]
+        length = elem.get('len')
+        if length is not None and length != 'null-terminated':
+            if self.captureCount(elem, prefix, siblings) is None:
+                return ['decoder.Address(%s);' % value]
+            if type_name == 'void' and pointer_depth == 1:
+                return ['decoder.Blob(%s);' % value]
+            if pointer_depth == 1 and self.captureIsRaw(type_name) and not self.isHandleTypeDispatchable(type_name):
+                return ['decoder.Array(%s);' % value]
+            if pointer_depth == 1:
+                element_type = type_name
+                element = self.replayValue(type_name, 'elements[index]')
+            elif type_name == 'char' and pointer_depth == 2:
+                element_type = 'const char *'
+                element = 'elements[index] = decoder.String();'
+            else:
+                return ['decoder.Address(%s);' % value]
+            return ['if (decoder.Pointer()) {',
+                    '    const uint64_t count = decoder.Count();',
+                    '    auto elements = decoder.Allocate<%s>(count);' % element_type,
+                    '    for (uint64_t index = 0; index < count; ++index) %s' % element,
+                    '    %s = elements;' % value,
+                    '}']
+        if type_name == 'void' and pointer_depth == 2:
+            return ['%s = decoder.Allocate<void *>(1);' % value,
+                    'decoder.Address(*%s);' % value]
+        if type_name == 'void' or pointer_depth > 1:
+            return ['decoder.Address(%s);' % value]
+        return ['if (decoder.Pointer()) {',
+                '    auto element = decoder.Allocate<%s>(1);' % type_name,
+                '    %s' % self.replayValue(type_name, '*element'),
+                '    %s = element;' % value,
+                '}']
+    #
+    # Capture decoder of a struct that genCaptureEncoder wrote member by member
+    def genCaptureDecoder(self, struct_elem, name):
+        members = struct_elem.findall('member')
+        siblings = dict([(member.find('name').text, '*' in ''.join(member.itertext())) for member in members])
+        decoder = ['void CaptureDecode(ApiCaptureDecoder &decoder, %s &value) {' % name]
+        for member in members:
+            decoder.extend(['    ' + line for line in self.replayStatements(member, 'value.', siblings)])
+        decoder.append('}')
+        self.appendSection('struct', '\n'.join(decoder))
+        stype = members[0].get('values') if members and members[0].find('name').text == 'sType' else None
+        if stype is not None:
+            if (self.featureExtraProtect != None):
+                for target in [self.replay_pnext_cases, self.replay_size_cases]:
+                    target.append('#ifdef %s' % self.featureExtraProtect)
+            self.replay_pnext_cases.append('        case %s: {' % stype)
+            self.replay_pnext_cases.append('            auto value = decoder.Allocate<%s>(1);' % name)
+            self.replay_pnext_cases.append('            CaptureDecode(decoder, *value);')
+            self.replay_pnext_cases.append('            return value;')
+            self.replay_pnext_cases.append('        }')
+            self.replay_size_cases.append('        case %s:' % stype)
+            self.replay_size_cases.append('            return sizeof(%s);' % name)
+            if (self.featureExtraProtect != None):
+                for target in [self.replay_pnext_cases, self.replay_size_cases]:
+                    target.append('#endif')
+    #
+    # Replay function of a command, which decodes the parameters of its record and passes them to the chassis intercept
+    def genReplayFunction(self, cmdinfo, name):
+        params = cmdinfo.elem.findall('param')
+        resulttype = cmdinfo.elem.find('proto/type').text
+        siblings = dict([(param.find('name').text, '*' in ''.join(param.itertext())) for param in params])
+        param_names = [param.find('name').text for param in params]
+        if (self.featureExtraProtect != None):
+            self.replay_functions.append('#ifdef %s' % self.featureExtraProtect)
+        self.replay_functions.append('    Replay%s,' % name[2:])
+        if (self.featureExtraProtect != None):
+            self.replay_functions.append('#endif')
+        self.appendSection('command', '')
+        if name in self.replay_manual_functions:
+            decls = ['ReplayContext &context'] + [self.makeCParamDecl(param, 0).strip() for param in params]
+            if resulttype != 'void':
+                decls.append('%s result' % resulttype)
+            self.appendSection('command', 'void ReplayManual%s(%s);' % (name[2:], ', '.join(decls)))
+        self.appendSection('command', 'static bool Replay%s(ReplayContext &context, ApiCaptureDecoder &decoder) {' % name[2:])
+        for param in params:
+            decl = self.makeCParamDecl(param, 0).strip()
+            if re.search(r'\[\w+\]', decl) and decl.startswith('const '):
+                decl = decl[len('const '):]
+            self.appendSection('command', '    %s = {};' % decl)
+        for param in params:
+            size = self.capture_param_sizes.get((name, param.find('name').text))
+            for line in self.replayStatements(param, '', siblings, size):
+                self.appendSection('command', '    ' + line)
+        if resulttype != 'void':
+            self.appendSection('command', '    %s result = {};' % resulttype)
+            self.appendSection('command', '    decoder.Value(result);')
+        self.appendSection('command', '    if (!decoder.Finished()) return false;')
+        if resulttype != 'void':
+            self.appendSection('command', '    context.BeginCall(CaptureId%s, result);' % name[2:])
+        else:
+            self.appendSection('command', '    context.BeginCall(CaptureId%s);' % name[2:])
+        if name in self.replay_manual_functions:
+            args = ['context'] + param_names + (['result'] if resulttype != 'void' else [])
+            self.appendSection('command', '    ReplayManual%s(%s);' % (name[2:], ', '.join(args)))
+        else:
+            self.appendSection('command', '    vulkan_layer_chassis::%s(%s);' % (name[2:], ', '.join(param_names)))
+        self.appendSection('command', '    context.EndCall();')
+        self.appendSection('command', '    return true;')
+        self.appendSection('command', '}')
+    #
+    # Down-chain stub of a command, which returns the result recorded for the call being replayed and leaves its outputs as
+    # the replay function decoded them
+    def genReplayStub(self, cmdinfo, name):
+        params = cmdinfo.elem.findall('param')
+        resulttype = cmdinfo.elem.find('proto/type').text
+        decls = ', '.join([self.makeCParamDecl(param, 0).strip() for param in params])
+        if (self.featureExtraProtect != None):
+            self.replay_stubs.append('#ifdef %s' % self.featureExtraProtect)
+        self.replay_stubs.append('    {"%s", reinterpret_cast<PFN_vkVoidFunction>(Stub%s)},' % (name, name[2:]))
+        if (self.featureExtraProtect != None):
+            self.replay_stubs.append('#endif')
+        self.appendSection('command', '')
+        if name in self.replay_manual_stubs:
+            self.appendSection('command', 'VKAPI_ATTR %s VKAPI_CALL Stub%s(%s);' % (resulttype, name[2:], decls))
+            return
+        self.appendSection('command', 'static VKAPI_ATTR %s VKAPI_CALL Stub%s(%s) {' % (resulttype, name[2:], decls))
+        if resulttype != 'void':
+            command = 'CaptureIdCount' if name in self.capture_ignore_functions else 'CaptureId%s' % name[2:]
+            self.appendSection('command', '    return StubResult<%s>(%s);' % (resulttype, command))
+        self.appendSection('command', '}')
+    #
+    # Hash of a command name, matching HashInterceptName in the generated source. Names are read eight characters at a time.
+    @staticmethod
+    def hashInterceptName(name):
+        value = 0xcbf29ce484222325
+        data = name.encode()
+        for start in range(0, len(data), 8):
+            word = int.from_bytes(data[start:start + 8], 'little')
+            value = ((value ^ word) * 0x9e3779b97f4a7c15) & 0xffffffffffffffff
+            value ^= value >> 32
+        return value
+    #
+    # Slot of a hash for a bucket seed, matching InterceptSlot in the generated source
+    @staticmethod
+    def interceptSlot(value, seed, count):
+        mixed = (value ^ (seed * 0x9e3779b97f4a7c15)) & 0xffffffffffffffff
+        return (((mixed * 0xff51afd7ed558ccd) & 0xffffffffffffffff) >> 32) % count
+    #
+    # Write the intercepted commands as a minimal perfect hash table. The high half of each name's hash picks a bucket. A
+    # bucket of several names holds the seed that places all of them in free slots; a bucket of one name holds its slot
+    # directly. Commands that the preprocessor leaves out keep their slot with a null funcptr, so that the table is the same on
+    # every platform.
+    def writeInterceptTable(self):
+        count = len(self.intercepts)
+        hashes = [self.hashInterceptName(intercept[0]) for intercept in self.intercepts]
+        if len(set(hashes)) != count:
+            raise Exception('Intercepted command names have colliding hashes')
+        buckets = [[] for _ in range(count)]
+        for index, value in enumerate(hashes):
+            buckets[(value >> 32) % count].append(index)
+        displacements = [0] * count
+        slots = [None] * count
+        for bucket in sorted([bucket for bucket in buckets if len(bucket) > 1], key=len, reverse=True):
+            seed = 1
+            while True:
+                placed = [self.interceptSlot(hashes[index], seed, count) for index in bucket]
+                if len(set(placed)) == len(placed) and all(slots[slot] is None for slot in placed):
+                    break
+                seed += 1
+            displacements[(hashes[bucket[0]] >> 32) % count] = seed
+            for index, slot in zip(bucket, placed):
+                slots[slot] = index
+        free_slots = [slot for slot in range(count) if slots[slot] is None]
+        for bucket in [bucket for bucket in buckets if len(bucket) == 1]:
+            slot = free_slots.pop()
+            displacements[(hashes[bucket[0]] >> 32) % count] = -slot - 1
+            slots[slot] = bucket[0]
+
+        write('// Hash of a command name, for the intercept table', file=self.outFile)
+        write('static constexpr uint64_t HashInterceptName(const char *name) {', file=self.outFile)
+        write('    uint64_t hash = 0xcbf29ce484222325ull;', file=self.outFile)
+        write('    while (*name) {', file=self.outFile)
+        write('        uint64_t word = 0;', file=self.outFile)
+        write('        for (uint32_t shift = 0; shift < 64 && *name; shift += 8, ++name) {', file=self.outFile)
+        write('            word |= static_cast<uint64_t>(static_cast<uint8_t>(*name)) << shift;', file=self.outFile)
+        write('        }', file=self.outFile)
+        write('        hash = (hash ^ word) * 0x9e3779b97f4a7c15ull;', file=self.outFile)
+        write('        hash ^= hash >> 32;', file=self.outFile)
+        write('    }', file=self.outFile)
+        write('    return hash;', file=self.outFile)
+        write('}', file=self.outFile)
+        name = self.intercepts[slots[0]][0]
+        write('static_assert(HashInterceptName("%s") == 0x%xull, "Intercept table hash differs from the generator");' % (name, hashes[slots[0]]), file=self.outFile)
+        self.newline()
+        write('static constexpr uint32_t intercept_count = %d;' % count, file=self.outFile)
+        self.newline()
+        write('static constexpr uint32_t InterceptSlot(uint64_t hash, uint32_t seed) {', file=self.outFile)
+        write('    return static_cast<uint32_t>(((hash ^ (seed * 0x9e3779b97f4a7c15ull)) * 0xff51afd7ed558ccdull) >> 32) % intercept_count;', file=self.outFile)
+        write('}', file=self.outFile)
+        self.newline()
+        write('// Seed that places the names of each bucket, or minus one minus the slot of a bucket with a single name', file=self.outFile)
+        write('static constexpr int32_t intercept_displacements[intercept_count] = {', file=self.outFile)
+        for start in range(0, count, 16):
+            write('    ' + ' '.join(['%d,' % value for value in displacements[start:start + 16]]), file=self.outFile)
+        write('};', file=self.outFile)
+        self.newline()
+        write('// All APIs intercepted by this layer, in hash table order', file=self.outFile)
+        write('static const InterceptEntry intercept_table[intercept_count] = {', file=self.outFile)
+        for slot in range(count):
+            name, protect, device_extension = self.intercepts[slots[slot]]
+            extension = '"%s"' % device_extension if device_extension else 'nullptr'
+            if protect is not None:
+                write('#ifdef %s' % protect, file=self.outFile)
+            write('    {"%s", (void*)%s, %s},' % (name, name[2:], extension), file=self.outFile)
+            if protect is not None:
+                write('#else', file=self.outFile)
+                write('    {"%s", nullptr, %s},' % (name, extension), file=self.outFile)
+                write('#endif', file=self.outFile)
+        write('};', file=self.outFile)
+        self.newline()
+        write('const InterceptEntry *FindIntercept(const char *name) {', file=self.outFile)
+        write('    const uint64_t hash = HashInterceptName(name);', file=self.outFile)
+        write('    const int32_t displacement = intercept_displacements[static_cast<uint32_t>(hash >> 32) % intercept_count];', file=self.outFile)
+        write('    const uint32_t slot =', file=self.outFile)
+        write('        displacement < 0 ? static_cast<uint32_t>(-displacement - 1) : InterceptSlot(hash, static_cast<uint32_t>(displacement));', file=self.outFile)
+        write('    return strcmp(intercept_table[slot].name, name) == 0 ? &intercept_table[slot] : nullptr;', file=self.outFile)
+        write('}', file=self.outFile)
+        self.newline()
+    #
+    # Lock statement for a state-recording hook; vkCmd* recording only needs to lock the target command buffer
+    def recordLock(self, name, dispatchable_type, dispatchable_name):
+        if dispatchable_type == 'VkCommandBuffer' and name not in self.exclusive_command_buffer_record_functions:
+            if name.startswith('vkCmd') or name == 'vkEndCommandBuffer':
+                return 'auto lock = intercept->command_buffer_write_lock(%s);' % dispatchable_name
+        return 'auto lock = intercept->write_lock();'
+    #
+    # Loop header walking only the validation objects that implement the given hook
+    def interceptLoop(self, hook):
+        return 'for (auto intercept : layer_data->intercept_vectors[InterceptId%s]) {' % hook
+    #
+    # Profiler timing for one validation object's hook, declared ahead of its lock so that lock waits are included
+    def profileScope(self, hook):
+        return 'ChassisProfileScope profile(layer_data->profiler, InterceptId%s, intercept->container_type);' % hook
+    #
     # Command generation
     def genCmd(self, cmdinfo, name, alias):
         ignore_functions = [
@@ -1627,6 +2860,15 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
         if name in ignore_functions:
             return
 
+        if self.replay:
+            self.genReplayStub(cmdinfo, name)
+            if name not in self.capture_ignore_functions:
+                self.genReplayFunction(cmdinfo, name)
+            return
+
+        if name not in self.capture_ignore_functions:
+            self.genCaptureFunction(cmdinfo, name)
+
         if self.header: # In the header declare all intercepts
             self.appendSection('command', '')
             self.appendSection('command', self.makeCDecls(cmdinfo.elem)[0])
@@ -1637,27 +2879,30 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
                 self.layer_factory += self.BaseClassCdecl(cmdinfo.elem, name)
             if (self.featureExtraProtect != None):
                 self.layer_factory += '#endif\n'
+            if name not in self.manual_functions:
+                self.recordInterceptHooks(cmdinfo, name)
+            elif name in self.profiled_manual_functions:
+                self.recordInterceptHooks(cmdinfo, name, dispatch_vectors=False)
             return
 
+        device_extension = GetDeviceCommandExtension(self.registry, self.featureName, name, cmdinfo.elem)
         if name in self.manual_functions:
+            if name in self.profiled_manual_functions:
+                self.recordInterceptHooks(cmdinfo, name, dispatch_vectors=False)
             if 'ValidationCache' not in name:
-                self.intercepts += [ '    {"%s", (void*)%s},' % (name,name[2:]) ]
+                self.intercepts.append((name, None, device_extension))
             else:
-                self.intercepts += [ '#ifdef BUILD_CORE_VALIDATION' ]
-                self.intercepts += [ '    {"%s", (void*)%s},' % (name,name[2:]) ]
-                self.intercepts += [ '#endif' ]
+                self.intercepts.append((name, 'BUILD_CORE_VALIDATION', device_extension))
             return
         # Record that the function will be intercepted
-        if (self.featureExtraProtect != None):
-            self.intercepts += [ '#ifdef %s' % self.featureExtraProtect ]
-        self.intercepts += [ '    {"%s", (void*)%s},' % (name,name[2:]) ]
-        if (self.featureExtraProtect != None):
-            self.intercepts += [ '#endif' ]
+        self.intercepts.append((name, self.featureExtraProtect, device_extension))
+        self.recordInterceptHooks(cmdinfo, name)
         OutputGenerator.genCmd(self, cmdinfo, name, alias)
         #
         decls = self.makeCDecls(cmdinfo.elem)
         self.appendSection('command', '')
         self.appendSection('command', '%s {' % decls[0][:-1])
+        self.appendSection('command', '    ChassisTraceScope call_trace("%s", "Chassis");' % name)
         # Setup common to call wrappers. First parameter is always dispatchable
         dispatchable_type = cmdinfo.elem.find('param/type').text
         dispatchable_name = cmdinfo.elem.find('param/name').text
@@ -1688,19 +2933,57 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
         if (resulttype.text != 'void'):
             assignresult = resulttype.text + ' result = '
 
+        # Deferred validation runs every validation object but thread safety (which must observe the calling thread) on a
+        # worker after the call is dispatched down the chain
+        deferrable = False
+        if name in self.deferred_barrier_functions or (dispatchable_type == 'VkCommandBuffer' and
+                name not in self.exclusive_command_buffer_record_functions and
+                (name.startswith('vkCmd') or name in self.deferred_command_buffer_functions)):
+            deferrable = self.captureParams(cmdinfo) is not None
+        skip_deferred = ''
+        if deferrable:
+            self.appendSection('command', '    const bool deferred = layer_data->deferred_validation != nullptr;')
+            skip_deferred = '        if (deferred && intercept->container_type != LayerObjectTypeThreading) continue;'
+        elif device_or_instance == 'device' and (name.startswith(self.deferred_sync_prefixes) or
+                                                 name in self.deferred_sync_functions):
+            self.appendSection('command', '    if (layer_data->deferred_validation) layer_data->deferred_validation->Drain();')
+
+        # Frame sampling skips the check-only PreCallValidate hooks of device functions outside the sampled frames
+        skip_unsampled = ''
+        if (device_or_instance == 'device' and name not in self.exclusive_validate_functions and
+                name not in self.recording_validate_functions):
+            self.appendSection('command', '    const bool validate_frame = layer_data->ValidateCurrentFrame();')
+            skip_unsampled = '        if (!validate_frame) break;'
+
         # Set up skip and locking
         self.appendSection('command', '    bool skip = false;')
 
+        validate_lock = 'auto lock = intercept->read_lock();'
+        if name in self.exclusive_validate_functions:
+            validate_lock = 'auto lock = intercept->write_lock();'
+        record_lock = self.recordLock(name, dispatchable_type, dispatchable_name)
+        returnparam = ''
+        if (resulttype.text == 'VkResult'):
+            returnparam = ', result'
+
         # Generate pre-call validation source code
-        self.appendSection('command', '    %s' % self.precallvalidate_loop)
-        self.appendSection('command', '        auto lock = intercept->write_lock();')
+        self.appendSection('command', '    %s' % self.interceptLoop('PreCallValidate' + api_function_name[2:]))
+        if skip_unsampled:
+            self.appendSection('command', skip_unsampled)
+        if skip_deferred:
+            self.appendSection('command', skip_deferred)
+        self.appendSection('command', '        %s' % self.profileScope('PreCallValidate' + api_function_name[2:]))
+        self.appendSection('command', '        %s' % validate_lock)
         self.appendSection('command', '        skip |= intercept->PreCallValidate%s(%s);' % (api_function_name[2:], paramstext))
         self.appendSection('command', '        if (skip) %s' % return_map[resulttype.text])
         self.appendSection('command', '    }')
 
         # Generate pre-call state recording source code
-        self.appendSection('command', '    %s' % self.precallrecord_loop)
-        self.appendSection('command', '        auto lock = intercept->write_lock();')
+        self.appendSection('command', '    %s' % self.interceptLoop('PreCallRecord' + api_function_name[2:]))
+        if skip_deferred:
+            self.appendSection('command', skip_deferred)
+        self.appendSection('command', '        %s' % self.profileScope('PreCallRecord' + api_function_name[2:]))
+        self.appendSection('command', '        %s' % record_lock)
         self.appendSection('command', '        intercept->PreCallRecord%s(%s);' % (api_function_name[2:], paramstext))
         self.appendSection('command', '    }')
 
@@ -1708,21 +2991,79 @@ VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVe
         if name in self.pre_dispatch_debug_utils_functions:
             self.appendSection('command', '    %s' % self.pre_dispatch_debug_utils_functions[name])
 
+        # Destroy and free calls are numbered in the API capture before they are dispatched: once the driver returns, it may hand
+        # the same handle to a create on another thread, whose record must come after this one
+        release_call = api_function_name.startswith(('vkDestroy', 'vkFree'))
+        if release_call:
+            self.appendSection('command', '    ApiCapture *capture = ApiCapture::Active();')
+            self.appendSection('command', '    if (capture) capture->ReserveSequence();')
+
         # Output dispatch (down-chain) function call
+        self.appendSection('command', '    ChassisProfileScope dispatch_profile(layer_data->profiler, InterceptIdDispatch%s, layer_data->container_type);' % api_function_name[2:])
         self.appendSection('command', '    ' + assignresult + API + paramstext + ');')
+        self.appendSection('command', '    dispatch_profile.End();')
 
         # Insert post-dispatch debug utils function call
         if name in self.post_dispatch_debug_utils_functions:
             self.appendSection('command', '    %s' % self.post_dispatch_debug_utils_functions[name])
 
+        # Record the call, with its outputs, in the API capture
+        if not release_call:
+            self.appendSection('command', '    ApiCapture *capture = ApiCapture::Active();')
+        self.appendSection('command', '    if (capture) Capture%s(capture, %s%s);' % (api_function_name[2:], paramstext, ', result' if resulttype.text != 'void' else ''))
+
         # Generate post-call object processing source code
-        self.appendSection('command', '    %s' % self.postcallrecord_loop)
-        returnparam = ''
-        if (resulttype.text == 'VkResult'):
-            returnparam = ', result'
-        self.appendSection('command', '        auto lock = intercept->write_lock();')
+        self.appendSection('command', '    %s' % self.interceptLoop('PostCallRecord' + api_function_name[2:]))
+        if skip_deferred:
+            self.appendSection('command', skip_deferred)
+        self.appendSection('command', '        %s' % self.profileScope('PostCallRecord' + api_function_name[2:]))
+        self.appendSection('command', '        %s' % record_lock)
         self.appendSection('command', '        intercept->PostCallRecord%s(%s%s);' % (api_function_name[2:], paramstext, returnparam))
         self.appendSection('command', '    }')
+
+        # A present ends the current frame for frame sampling, and for the summaries of duplicate messages
+        if name == 'vkQueuePresentKHR':
+            self.appendSection('command', '    layer_data->presented_frames.fetch_add(1, std::memory_order_relaxed);')
+            self.appendSection('command', '    ReportSuppressedMessages(layer_data->report_data);')
+
+        # Queue the remaining hooks on a deferred validation worker, working from copies of the parameters. The call has
+        # already been dispatched, so the state is recorded whatever the validation result.
+        if deferrable:
+            copies, captures, args = self.captureParams(cmdinfo)
+            if (resulttype.text != 'void'):
+                captures.append('result')
+            if skip_unsampled:
+                captures.append('validate_frame')
+            argstext = ', '.join(args)
+            self.appendSection('command', '    if (deferred) {')
+            for copy in copies:
+                self.appendSection('command', '        %s' % copy)
+            if name in self.deferred_barrier_functions:
+                self.appendSection('command', '        layer_data->deferred_validation->EnqueueBarrier([%s]() {' % ', '.join(captures))
+            else:
+                self.appendSection('command', '        layer_data->deferred_validation->Enqueue(%s, [%s]() {' % (dispatchable_name, ', '.join(captures)))
+            self.appendSection('command', '            %s' % self.interceptLoop('PreCallValidate' + api_function_name[2:]))
+            if skip_unsampled:
+                self.appendSection('command', '        ' + skip_unsampled)
+            self.appendSection('command', '                if (intercept->container_type == LayerObjectTypeThreading) continue;')
+            self.appendSection('command', '                %s' % self.profileScope('PreCallValidate' + api_function_name[2:]))
+            self.appendSection('command', '                %s' % validate_lock)
+            self.appendSection('command', '                intercept->PreCallValidate%s(%s);' % (api_function_name[2:], argstext))
+            self.appendSection('command', '            }')
+            self.appendSection('command', '            %s' % self.interceptLoop('PreCallRecord' + api_function_name[2:]))
+            self.appendSection('command', '                if (intercept->container_type == LayerObjectTypeThreading) continue;')
+            self.appendSection('command', '                %s' % self.profileScope('PreCallRecord' + api_function_name[2:]))
+            self.appendSection('command', '                %s' % record_lock)
+            self.appendSection('command', '                intercept->PreCallRecord%s(%s);' % (api_function_name[2:], argstext))
+            self.appendSection('command', '            }')
+            self.appendSection('command', '            %s' % self.interceptLoop('PostCallRecord' + api_function_name[2:]))
+            self.appendSection('command', '                if (intercept->container_type == LayerObjectTypeThreading) continue;')
+            self.appendSection('command', '                %s' % self.profileScope('PostCallRecord' + api_function_name[2:]))
+            self.appendSection('command', '                %s' % record_lock)
+            self.appendSection('command', '                intercept->PostCallRecord%s(%s%s);' % (api_function_name[2:], argstext, returnparam))
+            self.appendSection('command', '            }')
+            self.appendSection('command', '        });')
+            self.appendSection('command', '    }')
         # Return result variable, if any.
         if (resulttype.text != 'void'):
             self.appendSection('command', '    return result;')
@@ -408,8 +408,11 @@ public:
 
     // Override chassis read/write locks for this validation object
     // This override takes a deferred lock. i.e. it is not acquired.
-    std::unique_lock<std::mutex> write_lock() {
-        return std::unique_lock<std::mutex>(validation_object_mutex, std::defer_lock);
+    read_lock_guard_t read_lock() {
+        return read_lock_guard_t(validation_object_mutex, std::defer_lock);
+    }
+    write_lock_guard_t write_lock() {
+        return write_lock_guard_t(validation_object_mutex, std::defer_lock);
     }
 
     std::mutex command_pool_lock;
@@ -0,0 +1,120 @@
+#!/usr/bin/env python3
+# Copyright (c) 2019 The Khronos Group Inc.
+# Copyright (c) 2019 Valve Corporation
+# Copyright (c) 2019 LunarG, Inc.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Reads the binary log written by the validation layers with log_format = binary, and prints its records as JSON lines in
+# the same form as log_format = jsonl. The record layout is described next to BinaryLogHeader() in layers/vk_layer_logging.h.
+
+import argparse
+import json
+import mmap
+import struct
+import sys
+
+BINARY_LOG_MAGIC = 0x424c5656
+BINARY_LOG_VERSION = 1
+
+# VkDebugUtilsMessageSeverityFlagBitsEXT names, as printed by PrintMessageSeverity()
+SEVERITY_NAMES = [
+    (0x0001, 'VERBOSE'),
+    (0x0010, 'INFO'),
+    (0x0100, 'WARN'),
+    (0x1000, 'ERROR'),
+]
+
+def severity_name(severity):
+    return ','.join(name for bit, name in SEVERITY_NAMES if severity & bit)
+
+class RecordReader:
+    def __init__(self, data, offset):
+        self.data = data
+        self.offset = offset
+
+    def u32(self):
+        value, = struct.unpack_from('<I', self.data, self.offset)
+        self.offset += 4
+        return value
+
+    def u64(self):
+        value, = struct.unpack_from('<Q', self.data, self.offset)
+        self.offset += 8
+        return value
+
+    def str(self):
+        length = self.u32()
+        value = self.data[self.offset:self.offset + length].decode('utf-8', errors='replace')
+        self.offset += length
+        return value
+
+# Yield each record of a binary log as a dict
+def read_records(data):
+    if len(data) < 8:
+        raise ValueError('file is too short to be a binary validation log')
+    magic, version = struct.unpack_from('<II', data, 0)
+    if magic != BINARY_LOG_MAGIC:
+        raise ValueError('not a binary validation log')
+    if version != BINARY_LOG_VERSION:
+        raise ValueError('unsupported binary validation log version %d' % version)
+    offset = 8
+    while offset + 4 <= len(data):
+        size, = struct.unpack_from('<I', data, offset)
+        if offset + 4 + size > len(data):
+            # The application exited while the record was being written
+            break
+        reader = RecordReader(data, offset + 4)
+        record = {}
+        record['time_ns'] = reader.u64()
+        record['thread'] = reader.u64()
+        severity = reader.u32()
+        message_type = reader.u32()
+        record['vuid'] = reader.str()
+        message = reader.str()
+        record['severity'] = severity_name(severity)
+        record['type'] = message_type
+        record['objects'] = []
+        for _ in range(reader.u32()):
+            handle = reader.u64()
+            object_type = reader.u32()
+            name = reader.str()
+            record['objects'].append({'handle': '0x%x' % handle, 'type': object_type, 'name': name})
+        record['queue_labels'] = [reader.str() for _ in range(reader.u32())]
+        record['cmd_buf_labels'] = [reader.str() for _ in range(reader.u32())]
+        record['message'] = message
+        yield record
+        offset += 4 + size
+
+def main():
+    parser = argparse.ArgumentParser(description='Print the records of a binary validation layer log as JSON lines.')
+    parser.add_argument('log_file', help='log written with log_format = binary')
+    parser.add_argument('--vuid', action='append', help='only print records with this VUID (may be repeated)')
+    parser.add_argument('--count', action='store_true', help='print the number of records per VUID instead of the records')
+    args = parser.parse_args()
+
+    counts = {}
+    with open(args.log_file, 'rb') as log_file:
+        with mmap.mmap(log_file.fileno(), 0, access=mmap.ACCESS_READ) as data:
+            for record in read_records(data):
+                if args.vuid and record['vuid'] not in args.vuid:
+                    continue
+                if args.count:
+                    counts[record['vuid']] = counts.get(record['vuid'], 0) + 1
+                else:
+                    sys.stdout.write(json.dumps(record) + '\n')
+    for vuid, count in sorted(counts.items(), key=lambda item: -item[1]):
+        print('%d %s' % (count, vuid))
+
+if __name__ == '__main__':
+    main()
@@ -505,7 +505,7 @@ class OutputDatabase:
 // Disable auto-formatting for generated file
 // clang-format off
 
-// Mapping from VUID string to the corresponding spec text
+// Mapping from VUID string to the corresponding spec text, sorted by VUID string
 typedef struct _vuid_spec_text_pair {
     const char * vuid;
     const char * spec_text;
@@ -600,16 +600,22 @@ static const vuid_spec_text_pair vuid_spec_text[] = {
             vuid_list = list(self.vj.all_vuids)
             vuid_list.sort()
             cmd_dict = {}
+            table_entries = []
             for vuid in vuid_list:
                 db_entry = self.vj.vuid_db[vuid][0]
                 db_text = db_entry['text'].strip(' ')
-                hfile.write('    {"%s", "%s (%s#%s)"},\n' % (vuid, db_text, self.spec_url, vuid))
+                table_entries.append((vuid, '    {"%s", "%s (%s#%s)"},\n' % (vuid, db_text, self.spec_url, vuid)))
                 # For multiply-defined VUIDs, include versions with extension appended
                 if len(self.vj.vuid_db[vuid]) > 1:
                     for db_entry in self.vj.vuid_db[vuid]:
-                        hfile.write('    {"%s[%s]", "%s (%s#%s)"},\n' % (vuid, db_entry['ext'].strip(' '), db_text, self.spec_url, vuid))
+                        ext_vuid = '%s[%s]' % (vuid, db_entry['ext'].strip(' '))
+                        table_entries.append((ext_vuid, '    {"%s", "%s (%s#%s)"},\n' % (ext_vuid, db_text, self.spec_url, vuid)))
                 if 'commandBuffer must be in the recording state' in db_text:
                     cmd_dict[vuid] = db_text 
+            # The layers binary search this table, so it must be in strcmp() order
+            table_entries.sort(key=lambda entry: entry[0].encode())
+            for table_entry in table_entries:
+                hfile.write(table_entry[1])
             hfile.write(self.header_postamble)
 
             # Generate the information for validating recording state VUID's 
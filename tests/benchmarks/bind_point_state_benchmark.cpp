@@ -0,0 +1,222 @@
+/* Copyright (c) 2019 The Khronos Group Inc.
+ * Copyright (c) 2019 Valve Corporation
+ * Copyright (c) 2019 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Compares the per bind point state CoreChecks keeps for each command buffer, a BindPointArray with the dynamic offsets in a
+// DynamicOffsetArena, with the std::map<uint32_t, LAST_BOUND_STATE> holding a vector of offsets per set that it replaced. Each
+// draw binds descriptor sets with dynamic offsets and then reads the bound state back the way a draw validates it. Every few
+// draws a single set is bound with a layout that disturbs the sets above it, as switching pipeline layouts does.
+//
+//     vk_layer_bind_point_benchmark [draws per recording]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <new>
+#include <vector>
+
+#include "bind_point_state.h"
+
+namespace {
+
+size_t allocation_count = 0;
+
+}  // namespace
+
+void *operator new(size_t size) {
+    allocation_count++;
+    void *memory = malloc(size ? size : 1);
+    if (!memory) throw std::bad_alloc();
+    return memory;
+}
+void operator delete(void *memory) noexcept { free(memory); }
+void operator delete(void *memory, size_t) noexcept { free(memory); }
+
+namespace {
+
+const uint32_t kSetCount = 4;
+const uint32_t kOffsetsPerSet = 2;
+const int kRecordings = 200;
+
+// Stand-ins for the descriptor set and pipeline layout compatibility state of LAST_BOUND_STATE
+typedef const void *DescriptorSet;
+typedef uint64_t CompatId;
+
+struct MapLastBound {
+    std::vector<DescriptorSet> sets;
+    std::vector<std::vector<uint32_t>> dynamic_offsets;
+    std::vector<CompatId> compat_ids;
+    void reset() {
+        sets.clear();
+        dynamic_offsets.clear();
+        compat_ids.clear();
+    }
+};
+
+class MapCommandBuffer {
+   public:
+    void Reset() {
+        for (auto &item : last_bound_) item.second.reset();
+    }
+    void Bind(VkPipelineBindPoint bind_point, uint32_t first_set, uint32_t set_count, const DescriptorSet *sets,
+              const uint32_t *offsets) {
+        auto &last_bound = last_bound_[bind_point];
+        const uint32_t required_size = first_set + set_count;
+        last_bound.sets.resize(required_size);
+        last_bound.dynamic_offsets.resize(required_size);
+        last_bound.compat_ids.resize(required_size);
+        for (uint32_t i = 0; i < set_count; i++) {
+            last_bound.sets[first_set + i] = sets[i];
+            last_bound.compat_ids[first_set + i] = first_set + i + 1;
+            last_bound.dynamic_offsets[first_set + i] = std::vector<uint32_t>(offsets, offsets + kOffsetsPerSet);
+            offsets += kOffsetsPerSet;
+        }
+    }
+    uint64_t Draw(VkPipelineBindPoint bind_point) {
+        auto const &last_bound = last_bound_[bind_point];
+        uint64_t check = 0;
+        for (uint32_t set = 0; set < last_bound.sets.size(); set++) {
+            if (!last_bound.sets[set]) continue;
+            for (uint32_t i = 0; i < kOffsetsPerSet; i++) check += last_bound.dynamic_offsets[set][i];
+        }
+        return check;
+    }
+
+   private:
+    std::map<uint32_t, MapLastBound> last_bound_;
+};
+
+struct ArrayLastBound {
+    std::vector<DescriptorSet> sets;
+    std::vector<DynamicOffsetRange> dynamic_offsets;
+    std::vector<CompatId> compat_ids;
+    void reset() {
+        sets.clear();
+        dynamic_offsets.clear();
+        compat_ids.clear();
+    }
+};
+
+class ArrayCommandBuffer {
+   public:
+    void Reset() {
+        for (auto &last_bound : last_bound_) last_bound.reset();
+        arena_.clear();
+    }
+    void Bind(VkPipelineBindPoint bind_point, uint32_t first_set, uint32_t set_count, const DescriptorSet *sets,
+              const uint32_t *offsets) {
+        auto &last_bound = last_bound_[bind_point];
+        const uint32_t required_size = first_set + set_count;
+        const uint32_t current_size = static_cast<uint32_t>(last_bound.sets.size());
+        last_bound.sets.resize(required_size);
+        last_bound.compat_ids.resize(required_size);
+        if (required_size > last_bound.dynamic_offsets.size()) last_bound.dynamic_offsets.resize(required_size);
+        for (auto set = required_size; set < current_size; set++) last_bound.dynamic_offsets[set].count = 0;
+        for (uint32_t i = 0; i < set_count; i++) {
+            last_bound.sets[first_set + i] = sets[i];
+            last_bound.compat_ids[first_set + i] = first_set + i + 1;
+            arena_.Assign(&last_bound.dynamic_offsets[first_set + i], offsets, kOffsetsPerSet);
+            offsets += kOffsetsPerSet;
+        }
+    }
+    uint64_t Draw(VkPipelineBindPoint bind_point) {
+        auto const &last_bound = last_bound_[bind_point];
+        uint64_t check = 0;
+        for (uint32_t set = 0; set < last_bound.sets.size(); set++) {
+            if (!last_bound.sets[set]) continue;
+            const uint32_t *offsets = arena_.Get(last_bound.dynamic_offsets[set]);
+            for (uint32_t i = 0; i < kOffsetsPerSet; i++) check += offsets[i];
+        }
+        return check;
+    }
+
+   private:
+    BindPointArray<ArrayLastBound> last_bound_;
+    DynamicOffsetArena arena_;
+};
+
+double Seconds(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+template <typename CommandBuffer>
+uint64_t Record(CommandBuffer *cb, uint32_t draws, const DescriptorSet *sets, const uint32_t *offsets) {
+    uint64_t check = 0;
+    cb->Reset();
+    for (uint32_t draw = 0; draw < draws; draw++) {
+        // Draws alternate between a few offsets into the same buffers
+        const uint32_t *draw_offsets = offsets + (draw % 8) * kSetCount * kOffsetsPerSet;
+        if (draw % 4 == 0) cb->Bind(VK_PIPELINE_BIND_POINT_GRAPHICS, 0, 1, sets, draw_offsets);
+        cb->Bind(VK_PIPELINE_BIND_POINT_GRAPHICS, 0, kSetCount, sets, draw_offsets);
+        check += cb->Draw(VK_PIPELINE_BIND_POINT_GRAPHICS);
+        if (draw % 16 == 0) {
+            cb->Bind(VK_PIPELINE_BIND_POINT_COMPUTE, 0, kSetCount, sets, draw_offsets);
+            check += cb->Draw(VK_PIPELINE_BIND_POINT_COMPUTE);
+        }
+    }
+    return check;
+}
+
+struct Result {
+    double nanoseconds;
+    double allocations;
+    uint64_t check;
+};
+
+// Time recordings of one command buffer after a first recording has warmed it up. Costs are per bind + draw.
+template <typename CommandBuffer>
+Result Measure(uint32_t draws, const DescriptorSet *sets, const uint32_t *offsets) {
+    CommandBuffer cb;
+    Record(&cb, draws, sets, offsets);
+    Result result = {};
+    const size_t allocations = allocation_count;
+    const auto start = std::chrono::steady_clock::now();
+    for (int recording = 0; recording < kRecordings; recording++) result.check += Record(&cb, draws, sets, offsets);
+    const double calls = static_cast<double>(kRecordings) * draws;
+    result.nanoseconds = Seconds(start) * 1e9 / calls;
+    result.allocations = (allocation_count - allocations) / calls;
+    return result;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    const uint32_t draws = argc > 1 ? static_cast<uint32_t>(strtoul(argv[1], nullptr, 10)) : 10000;
+    if (!draws) {
+        fprintf(stderr, "usage: %s [draws per recording]\n", argv[0]);
+        return 1;
+    }
+
+    static const int set_storage[kSetCount] = {};
+    DescriptorSet sets[kSetCount];
+    for (uint32_t i = 0; i < kSetCount; i++) sets[i] = &set_storage[i];
+    std::vector<uint32_t> offsets(8 * kSetCount * kOffsetsPerSet);
+    for (size_t i = 0; i < offsets.size(); i++) offsets[i] = static_cast<uint32_t>(i * 256);
+
+    const Result map_result = Measure<MapCommandBuffer>(draws, sets, offsets.data());
+    const Result array_result = Measure<ArrayCommandBuffer>(draws, sets, offsets.data());
+    if (map_result.check != array_result.check) {
+        fprintf(stderr, "bound state differs between the implementations\n");
+        return 1;
+    }
+
+    printf("%u draws per recording, %u sets of %u dynamic offsets\n", draws, kSetCount, kOffsetsPerSet);
+    printf("%-28s %14s %14s\n", "", "std::map", "BindPointArray");
+    printf("%-28s %11.1f ns %11.1f ns\n", "bind + draw", map_result.nanoseconds, array_result.nanoseconds);
+    printf("%-28s %14.2f %14.2f\n", "allocations per draw", map_result.allocations, array_result.allocations);
+    return 0;
+}
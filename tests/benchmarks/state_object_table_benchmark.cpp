@@ -0,0 +1,139 @@
+/* Copyright (c) 2019 The Khronos Group Inc.
+ * Copyright (c) 2019 Valve Corporation
+ * Copyright (c) 2019 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Compares the StateObjectTable used for the CoreChecks object tables with the unordered_map<handle, unique_ptr<STATE>> it
+// replaced, for lookups of live handles and for a create/destroy stream that keeps a fixed number of objects alive.
+//
+//     vk_layer_state_table_benchmark [live object count]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "state_object_table.h"
+
+namespace {
+
+// Stand-in for a non-dispatchable handle and the state a CoreChecks table keeps for it
+typedef uint64_t Handle;
+struct State {
+    Handle handle;
+    uint64_t payload[31];
+    explicit State(Handle handle) : handle(handle), payload() {}
+};
+
+class UnorderedMapTable {
+   public:
+    State *Get(Handle handle) const {
+        auto it = map_.find(handle);
+        return it == map_.end() ? nullptr : it->second.get();
+    }
+    void Emplace(Handle handle) { map_[handle] = std::unique_ptr<State>(new State(handle)); }
+    void erase(Handle handle) { map_.erase(handle); }
+
+   private:
+    std::unordered_map<Handle, std::unique_ptr<State>> map_;
+};
+
+class FlatTable {
+   public:
+    State *Get(Handle handle) const { return table_.Get(handle); }
+    void Emplace(Handle handle) { table_.Emplace(handle, handle); }
+    void erase(Handle handle) { table_.erase(handle); }
+
+   private:
+    StateObjectTable<Handle, State> table_;
+};
+
+// Driver handles are usually addresses of driver objects: aligned, and scattered over the heap
+std::vector<Handle> MakeHandles(size_t count, uint32_t seed) {
+    std::mt19937_64 rng(seed);
+    std::vector<Handle> handles(count);
+    for (auto &handle : handles) handle = (rng() & 0x00007ffffffffff0ull) | 0x10;
+    return handles;
+}
+
+double Seconds(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+template <typename Table>
+double LookupNanoseconds(const std::vector<Handle> &handles, const std::vector<uint32_t> &order) {
+    Table table;
+    for (auto handle : handles) table.Emplace(handle);
+    uint64_t check = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (int pass = 0; pass < 20; pass++) {
+        for (auto index : order) check += table.Get(handles[index])->handle;
+    }
+    const double seconds = Seconds(start);
+    uint64_t expected = 0;
+    for (auto index : order) expected += handles[index];
+    if (check != expected * 20) {
+        fprintf(stderr, "lookup returned the wrong state\n");
+        exit(1);
+    }
+    return seconds * 1e9 / (20.0 * order.size());
+}
+
+template <typename Table>
+double ChurnNanoseconds(const std::vector<Handle> &handles, size_t live_count) {
+    Table table;
+    for (size_t i = 0; i < live_count; i++) table.Emplace(handles[i]);
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = live_count; i < handles.size(); i++) {
+        table.erase(handles[i - live_count]);
+        table.Emplace(handles[i]);
+    }
+    const double seconds = Seconds(start);
+    for (size_t i = handles.size() - live_count; i < handles.size(); i++) {
+        if (!table.Get(handles[i]) || table.Get(handles[i])->handle != handles[i]) {
+            fprintf(stderr, "churn lost a live handle\n");
+            exit(1);
+        }
+    }
+    return seconds * 1e9 / (handles.size() - live_count);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    const size_t live_count = argc > 1 ? strtoul(argv[1], nullptr, 10) : 20000;
+    if (!live_count) {
+        fprintf(stderr, "usage: %s [live object count]\n", argv[0]);
+        return 1;
+    }
+
+    const auto live_handles = MakeHandles(live_count, 1);
+    std::vector<uint32_t> order(live_count * 4);
+    std::mt19937 rng(2);
+    for (auto &index : order) index = rng() % live_count;
+
+    const auto churn_handles = MakeHandles(live_count + 1000000, 3);
+
+    printf("%zu live objects of %zu bytes\n", live_count, sizeof(State));
+    printf("%-28s %14s %14s\n", "", "unordered_map", "StateObjectTable");
+    printf("%-28s %11.1f ns %11.1f ns\n", "lookup", LookupNanoseconds<UnorderedMapTable>(live_handles, order),
+           LookupNanoseconds<FlatTable>(live_handles, order));
+    printf("%-28s %11.1f ns %11.1f ns\n", "erase + insert", ChurnNanoseconds<UnorderedMapTable>(churn_handles, live_count),
+           ChurnNanoseconds<FlatTable>(churn_handles, live_count));
+    return 0;
+}
@@ -0,0 +1,274 @@
+/* Copyright (c) 2019 The Khronos Group Inc.
+ * Copyright (c) 2019 Valve Corporation
+ * Copyright (c) 2019 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Round trips of API captures: the tests write a capture with the capture functions of the chassis, as the layer would while
+// an application runs, and replay it through the validation objects. They need no Vulkan driver.
+
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "chassis.h"
+#include "chassis_capture.h"
+#include "vk_layer_config.h"
+#include "vk_layer_replay.h"
+
+using namespace vulkan_layer_replay;
+using namespace vulkan_layer_chassis;
+
+namespace {
+
+// Handles that a driver could have returned to the captured application
+template <typename T>
+T FakeHandle(uint64_t value) {
+    return reinterpret_cast<T>(static_cast<uintptr_t>(value));
+}
+const VkInstance kInstance = FakeHandle<VkInstance>(0x1000);
+const VkPhysicalDevice kPhysicalDevice = FakeHandle<VkPhysicalDevice>(0x2000);
+const VkDevice kDevice = FakeHandle<VkDevice>(0x3000);
+const VkQueue kQueue = FakeHandle<VkQueue>(0x4000);
+const VkCommandBuffer kCommandBuffer = FakeHandle<VkCommandBuffer>(0x5000);
+const VkImage kSrcImage = CastFromUint64<VkImage>(0x6000);
+const VkImage kDstImage = CastFromUint64<VkImage>(0x7000);
+const VkCommandPool kCommandPool = CastFromUint64<VkCommandPool>(0x8000);
+
+const uint64_t kDeviceCreationCalls = 9;
+const uint64_t kUnboundImageCopyCalls = 12;
+
+// Write a capture file. The tests write their captures one after another from the same thread, which must get a ring of its own
+// in each one.
+template <typename Calls>
+void WriteCapture(const std::string &path, Calls calls) {
+    ApiCapture capture(path, CaptureIdCount, capture_id_names);
+    calls(&capture);
+}
+
+// The physical device state that the layer records when a device is created: a single queue family that can do everything,
+// and every feature of every core format
+void CapturePhysicalDeviceState(ApiCapture *capture, const VkQueueFamilyProperties &queue_family) {
+    VkPhysicalDeviceProperties properties = {};
+    properties.apiVersion = VK_API_VERSION_1_0;
+    properties.deviceType = VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU;
+    properties.limits.maxImageDimension1D = 4096;
+    properties.limits.maxImageDimension2D = 4096;
+    properties.limits.maxImageDimension3D = 256;
+    properties.limits.maxImageDimensionCube = 4096;
+    properties.limits.maxImageArrayLayers = 256;
+    properties.limits.maxMemoryAllocationCount = 4096;
+    properties.limits.maxBoundDescriptorSets = 4;
+    properties.limits.framebufferColorSampleCounts = VK_SAMPLE_COUNT_1_BIT;
+    VkPhysicalDeviceFeatures features = {};
+    VkPhysicalDeviceMemoryProperties memory_properties = {};
+    memory_properties.memoryTypeCount = 1;
+    memory_properties.memoryTypes[0].propertyFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
+                                                     VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+    memory_properties.memoryHeapCount = 1;
+    memory_properties.memoryHeaps[0].size = 256 * 1024 * 1024;
+    memory_properties.memoryHeaps[0].flags = VK_MEMORY_HEAP_DEVICE_LOCAL_BIT;
+    std::vector<VkFormatProperties> format_properties(VK_FORMAT_RANGE_SIZE, VkFormatProperties{~0u, ~0u, ~0u});
+
+    ApiCaptureEncoder &encoder = capture->BeginRecord();
+    encoder.Value(HandleToUint64(kPhysicalDevice));
+    encoder.Value(properties);
+    encoder.Value(features);
+    encoder.Value(memory_properties);
+    encoder.Array(&queue_family, 1);
+    encoder.Array(format_properties.data(), format_properties.size());
+    encoder.Value(VK_STRUCTURE_TYPE_MAX_ENUM);
+    capture->Record(CaptureIdPhysicalDeviceState, encoder);
+}
+
+void CaptureDeviceCreation(ApiCapture *capture) {
+    VkApplicationInfo app_info = {};
+    app_info.sType = VK_STRUCTURE_TYPE_APPLICATION_INFO;
+    app_info.apiVersion = VK_API_VERSION_1_0;
+    VkInstanceCreateInfo instance_info = {};
+    instance_info.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+    instance_info.pApplicationInfo = &app_info;
+    VkInstance instance = kInstance;
+    CaptureCreateInstance(capture, &instance_info, nullptr, &instance, VK_SUCCESS);
+
+    uint32_t gpu_count = 1;
+    VkPhysicalDevice gpu = kPhysicalDevice;
+    CaptureEnumeratePhysicalDevices(capture, instance, &gpu_count, nullptr, VK_SUCCESS);
+    CaptureEnumeratePhysicalDevices(capture, instance, &gpu_count, &gpu, VK_SUCCESS);
+
+    VkQueueFamilyProperties queue_family = {};
+    queue_family.queueFlags = VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT;
+    queue_family.queueCount = 1;
+    queue_family.minImageTransferGranularity = {1, 1, 1};
+    uint32_t queue_family_count = 1;
+    CaptureGetPhysicalDeviceQueueFamilyProperties(capture, gpu, &queue_family_count, nullptr);
+    CaptureGetPhysicalDeviceQueueFamilyProperties(capture, gpu, &queue_family_count, &queue_family);
+
+    const float priority = 1.0f;
+    VkDeviceQueueCreateInfo queue_info = {};
+    queue_info.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+    queue_info.queueFamilyIndex = 0;
+    queue_info.queueCount = 1;
+    queue_info.pQueuePriorities = &priority;
+    VkDeviceCreateInfo device_info = {};
+    device_info.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+    device_info.queueCreateInfoCount = 1;
+    device_info.pQueueCreateInfos = &queue_info;
+    VkDevice device = kDevice;
+    CapturePhysicalDeviceState(capture, queue_family);
+    CaptureCreateDevice(capture, gpu, &device_info, nullptr, &device, VK_SUCCESS);
+
+    VkQueue queue = kQueue;
+    CaptureGetDeviceQueue(capture, device, 0, 0, &queue);
+}
+
+void CaptureDeviceDestruction(ApiCapture *capture) {
+    CaptureDestroyDevice(capture, kDevice, nullptr);
+    CaptureDestroyInstance(capture, kInstance, nullptr);
+}
+
+// Records a copy between two images that were never bound to memory, which CoreChecks reports while the copy is recorded
+void CaptureUnboundImageCopy(ApiCapture *capture) {
+    VkImageCreateInfo image_info = {};
+    image_info.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+    image_info.imageType = VK_IMAGE_TYPE_2D;
+    image_info.format = VK_FORMAT_R8G8B8A8_UNORM;
+    image_info.extent = {32, 32, 1};
+    image_info.mipLevels = 1;
+    image_info.arrayLayers = 1;
+    image_info.samples = VK_SAMPLE_COUNT_1_BIT;
+    image_info.tiling = VK_IMAGE_TILING_OPTIMAL;
+    image_info.usage = VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+    image_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    image_info.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    VkImage src_image = kSrcImage;
+    VkImage dst_image = kDstImage;
+    CaptureCreateImage(capture, kDevice, &image_info, nullptr, &src_image, VK_SUCCESS);
+    CaptureCreateImage(capture, kDevice, &image_info, nullptr, &dst_image, VK_SUCCESS);
+
+    VkCommandPoolCreateInfo pool_info = {};
+    pool_info.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    pool_info.queueFamilyIndex = 0;
+    VkCommandPool pool = kCommandPool;
+    CaptureCreateCommandPool(capture, kDevice, &pool_info, nullptr, &pool, VK_SUCCESS);
+    VkCommandBufferAllocateInfo alloc_info = {};
+    alloc_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    alloc_info.commandPool = pool;
+    alloc_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    alloc_info.commandBufferCount = 1;
+    VkCommandBuffer command_buffer = kCommandBuffer;
+    CaptureAllocateCommandBuffers(capture, kDevice, &alloc_info, &command_buffer, VK_SUCCESS);
+
+    VkCommandBufferBeginInfo begin_info = {};
+    begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    CaptureBeginCommandBuffer(capture, command_buffer, &begin_info, VK_SUCCESS);
+    VkImageCopy region = {};
+    region.srcSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1};
+    region.dstSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1};
+    region.extent = {32, 32, 1};
+    CaptureCmdCopyImage(capture, command_buffer, src_image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, dst_image,
+                        VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+    CaptureEndCommandBuffer(capture, command_buffer, VK_SUCCESS);
+
+    CaptureFreeCommandBuffers(capture, kDevice, pool, 1, &command_buffer);
+    CaptureDestroyCommandPool(capture, kDevice, pool, nullptr);
+    CaptureDestroyImage(capture, kDevice, src_image, nullptr);
+    CaptureDestroyImage(capture, kDevice, dst_image, nullptr);
+}
+
+}  // namespace
+
+TEST(LayerReplay, DeviceCreationReportsNothing) {
+    const std::string path = "layer_replay_device_creation.vkcapture";
+    WriteCapture(path, [](ApiCapture *capture) {
+        CaptureDeviceCreation(capture);
+        CaptureDeviceDestruction(capture);
+    });
+
+    ReplayPrepareSettings();
+    ReplayContext context(path);
+    const ReplaySummary summary = ReplayCapture(context);
+    std::remove(path.c_str());
+
+    EXPECT_TRUE(summary.error.empty()) << summary.error;
+    EXPECT_FALSE(summary.truncated);
+    EXPECT_EQ(0u, summary.malformed);
+    EXPECT_EQ(0u, summary.skipped);
+    EXPECT_EQ(kDeviceCreationCalls, summary.replayed);
+    EXPECT_EQ(0u, context.error_count());
+}
+
+// Validation of vkCmd* calls queries the physical device through the stubs, which only find the replay on its own thread, so
+// the replay must validate synchronously even when the settings file asks for deferred validation
+TEST(LayerReplay, UnboundImageCopyReportsErrorsWithDeferredValidationRequested) {
+    const std::string path = "layer_replay_unbound_image_copy.vkcapture";
+    WriteCapture(path, [](ApiCapture *capture) {
+        CaptureDeviceCreation(capture);
+        CaptureUnboundImageCopy(capture);
+        CaptureDeviceDestruction(capture);
+    });
+
+    setLayerOption(OBJECT_LAYER_DESCRIPTION ".deferred_validation_threads", "4");
+    ReplayPrepareSettings();
+    EXPECT_STREQ("0", getLayerOption(OBJECT_LAYER_DESCRIPTION ".deferred_validation_threads"));
+    ReplayContext context(path);
+    const ReplaySummary summary = ReplayCapture(context);
+    std::remove(path.c_str());
+
+    EXPECT_TRUE(summary.error.empty()) << summary.error;
+    EXPECT_FALSE(summary.truncated);
+    EXPECT_EQ(0u, summary.malformed);
+    EXPECT_EQ(0u, summary.skipped);
+    EXPECT_EQ(kDeviceCreationCalls + kUnboundImageCopyCalls, summary.replayed);
+    EXPECT_GT(context.error_count(), 0u);
+}
+
+// Captures of different applications reuse the same handle values. Replayed concurrently, as vk_layer_replay --jobs does, each
+// must only see the state of its own objects: the errors of one capture do not leak into the other.
+TEST(LayerReplay, ConcurrentCapturesWithCollidingHandlesKeepStateApart) {
+    const std::string clean_path = "layer_replay_concurrent_clean.vkcapture";
+    const std::string copy_path = "layer_replay_concurrent_unbound_image_copy.vkcapture";
+    WriteCapture(clean_path, [](ApiCapture *capture) {
+        CaptureDeviceCreation(capture);
+        CaptureDeviceDestruction(capture);
+    });
+    WriteCapture(copy_path, [](ApiCapture *capture) {
+        CaptureDeviceCreation(capture);
+        CaptureUnboundImageCopy(capture);
+        CaptureDeviceDestruction(capture);
+    });
+
+    ReplayPrepareSettings();
+    std::vector<std::unique_ptr<ReplayContext>> contexts;
+    contexts.emplace_back(new ReplayContext(clean_path));
+    contexts.emplace_back(new ReplayContext(copy_path));
+    const std::vector<ReplaySummary> summaries = ReplayCaptures(contexts, 2);
+    std::remove(clean_path.c_str());
+    std::remove(copy_path.c_str());
+
+    ASSERT_EQ(2u, summaries.size());
+    for (const auto &summary : summaries) {
+        EXPECT_TRUE(summary.error.empty()) << summary.error;
+        EXPECT_FALSE(summary.truncated);
+        EXPECT_EQ(0u, summary.malformed);
+        EXPECT_EQ(0u, summary.skipped);
+    }
+    EXPECT_EQ(kDeviceCreationCalls, summaries[0].replayed);
+    EXPECT_EQ(kDeviceCreationCalls + kUnboundImageCopyCalls, summaries[1].replayed);
+    EXPECT_EQ(0u, contexts[0]->error_count());
+    EXPECT_GT(contexts[1]->error_count(), 0u);
+}
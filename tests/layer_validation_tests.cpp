@@ -50,6 +50,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdlib>
 #include <functional>
 #include <limits>
 #include <memory>
@@ -232,6 +233,104 @@ static VkImageViewCreateInfo SafeSaneImageViewCreateInfo(const VkImageObj &image
     return SafeSaneImageViewCreateInfo(image.handle(), format, aspect_mask);
 }
 
+// Sets an environment variable that the layer reads while in scope, and restores its previous value afterwards
+class ScopedEnvironmentVariable {
+   public:
+    ScopedEnvironmentVariable(const char *variable, const std::string &value)
+        : variable_(variable), had_previous_(Get(variable, &previous_)) {
+        Set(variable_, value.c_str());
+    }
+    ~ScopedEnvironmentVariable() { Set(variable_, had_previous_ ? previous_.c_str() : nullptr); }
+
+    // The layer does not read its environment variables on Android
+    static bool Supported() {
+#if defined(ANDROID)
+        return false;
+#else
+        return true;
+#endif
+    }
+
+    static bool Get(const char *variable, std::string *value) {
+#if defined(_WIN32)
+        const DWORD size = GetEnvironmentVariableA(variable, nullptr, 0);
+        if (size == 0) return false;
+        std::vector<char> buffer(size);
+        GetEnvironmentVariableA(variable, buffer.data(), size);
+        *value = buffer.data();
+        return true;
+#elif defined(ANDROID)
+        return false;
+#else
+        const char *current = getenv(variable);
+        if (!current) return false;
+        *value = current;
+        return true;
+#endif
+    }
+
+   private:
+    static void Set(const char *variable, const char *value) {
+#if defined(_WIN32)
+        SetEnvironmentVariableA(variable, value);
+#elif !defined(ANDROID)
+        if (value) {
+            setenv(variable, value, 1);
+        } else {
+            unsetenv(variable);
+        }
+#endif
+    }
+
+    const char *variable_;
+    std::string previous_;
+    bool had_previous_;
+};
+
+// Adds a VALIDATION_CHECK_ENABLE_* flag to the VK_LAYER_ENABLES environment variable while in scope. The layer reads the
+// variable when an instance is created.
+class ScopedLayerEnable : public ScopedEnvironmentVariable {
+   public:
+    explicit ScopedLayerEnable(const char *enable) : ScopedEnvironmentVariable("VK_LAYER_ENABLES", Enables(enable)) {}
+
+   private:
+    static std::string Enables(const char *enable) {
+#if defined(_WIN32)
+        const char *delimiter = ";";
+#else
+        const char *delimiter = ":";
+#endif
+        std::string enables;
+        if (Get("VK_LAYER_ENABLES", &enables) && !enables.empty()) return enables + delimiter + enable;
+        return enable;
+    }
+};
+
+// Creates a buffer bound to memory of its own, for tests that destroy the buffer while command buffers still use it. Returns
+// false, with nothing created, when the device has no memory type with the requested properties.
+static bool CreateBufferWithMemory(VkDeviceObj *device, VkBufferUsageFlags usage, VkMemoryPropertyFlags properties,
+                                   VkBuffer *buffer, VkDeviceMemory *memory) {
+    VkBufferCreateInfo buf_info = VkBufferObj::create_info(256, usage);
+    if (vkCreateBuffer(device->device(), &buf_info, NULL, buffer) != VK_SUCCESS) return false;
+
+    VkMemoryRequirements mem_reqs;
+    vkGetBufferMemoryRequirements(device->device(), *buffer, &mem_reqs);
+    VkMemoryAllocateInfo alloc_info = {};
+    alloc_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    alloc_info.allocationSize = mem_reqs.size;
+    if (!device->phy().set_memory_type(mem_reqs.memoryTypeBits, &alloc_info, properties) ||
+        vkAllocateMemory(device->device(), &alloc_info, NULL, memory) != VK_SUCCESS) {
+        vkDestroyBuffer(device->device(), *buffer, NULL);
+        return false;
+    }
+    if (vkBindBufferMemory(device->device(), *buffer, *memory, 0) != VK_SUCCESS) {
+        vkDestroyBuffer(device->device(), *buffer, NULL);
+        vkFreeMemory(device->device(), *memory, NULL);
+        return false;
+    }
+    return true;
+}
+
 // Helper for checking createRenderPass2 support and adding related extensions.
 static bool CheckCreateRenderPass2Support(VkRenderFramework *renderFramework, std::vector<const char *> &device_extension_names) {
     if (renderFramework->DeviceExtensionSupported(renderFramework->gpu(), nullptr, VK_KHR_CREATE_RENDERPASS_2_EXTENSION_NAME)) {
@@ -10424,6 +10523,221 @@ TEST_F(VkLayerTest, InvalidCmdBufferBufferDestroyed) {
     vkFreeMemory(m_device->handle(), mem, NULL);
 }
 
+TEST_F(VkLayerTest, InvalidCmdBufferVertexBufferDestroyed) {
+    TEST_DESCRIPTION("Attempt to submit a command buffer that is invalid due to a bound vertex buffer being destroyed.");
+    ASSERT_NO_FATAL_FAILURE(Init());
+
+    VkBuffer buffer;
+    VkDeviceMemory mem;
+    VkMemoryRequirements mem_reqs;
+
+    VkBufferCreateInfo buf_info = {};
+    buf_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    buf_info.usage = VK_BUFFER_USAGE_VERTEX_BUFFER_BIT;
+    buf_info.size = 256;
+    buf_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    VkResult err = vkCreateBuffer(m_device->device(), &buf_info, NULL, &buffer);
+    ASSERT_VK_SUCCESS(err);
+
+    vkGetBufferMemoryRequirements(m_device->device(), buffer, &mem_reqs);
+
+    VkMemoryAllocateInfo alloc_info = {};
+    alloc_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    alloc_info.allocationSize = mem_reqs.size;
+    bool pass = m_device->phy().set_memory_type(mem_reqs.memoryTypeBits, &alloc_info, 0);
+    if (!pass) {
+        printf("%s Failed to set memory type.\n", kSkipPrefix);
+        vkDestroyBuffer(m_device->device(), buffer, NULL);
+        return;
+    }
+    err = vkAllocateMemory(m_device->device(), &alloc_info, NULL, &mem);
+    ASSERT_VK_SUCCESS(err);
+
+    err = vkBindBufferMemory(m_device->device(), buffer, mem, 0);
+    ASSERT_VK_SUCCESS(err);
+
+    VkDeviceSize offset = 0;
+    m_commandBuffer->begin();
+    vkCmdBindVertexBuffers(m_commandBuffer->handle(), 0, 1, &buffer, &offset);
+    m_commandBuffer->end();
+
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, " that is invalid because bound Buffer ");
+    // Destroying the vertex buffer invalidates the command buffer that binds it, which is reported on submit
+    vkDestroyBuffer(m_device->device(), buffer, NULL);
+
+    VkSubmitInfo submit_info = {};
+    submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submit_info.commandBufferCount = 1;
+    submit_info.pCommandBuffers = &m_commandBuffer->handle();
+    vkQueueSubmit(m_device->m_queue, 1, &submit_info, VK_NULL_HANDLE);
+
+    m_errorMonitor->VerifyFound();
+    vkQueueWaitIdle(m_device->m_queue);
+    vkFreeMemory(m_device->handle(), mem, NULL);
+}
+
+TEST_F(VkLayerTest, InvalidCmdBufferBufferDestroyedLazyInvalidation) {
+    TEST_DESCRIPTION(
+        "Attempt to submit a command buffer that is invalid due to a buffer dependency being destroyed, with command buffers "
+        "invalidated lazily.");
+    if (!ScopedLayerEnable::Supported()) {
+        printf("%s Layer enables cannot be set on this platform.\n", kSkipPrefix);
+        return;
+    }
+    ScopedLayerEnable lazy_invalidation("VALIDATION_CHECK_ENABLE_LAZY_COMMAND_BUFFER_INVALIDATION");
+    ASSERT_NO_FATAL_FAILURE(Init());
+
+    VkBuffer buffer;
+    VkDeviceMemory mem;
+    if (!CreateBufferWithMemory(m_device, VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT, &buffer, &mem)) {
+        printf("%s Failed to create a buffer with host visible memory.\n", kSkipPrefix);
+        return;
+    }
+
+    m_commandBuffer->begin();
+    vkCmdFillBuffer(m_commandBuffer->handle(), buffer, 0, VK_WHOLE_SIZE, 0);
+    m_commandBuffer->end();
+
+    // The destroyed buffer is found when the command buffer is submitted
+    vkDestroyBuffer(m_device->device(), buffer, NULL);
+
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, " that is invalid because bound Buffer ");
+    VkSubmitInfo submit_info = {};
+    submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submit_info.commandBufferCount = 1;
+    submit_info.pCommandBuffers = &m_commandBuffer->handle();
+    vkQueueSubmit(m_device->m_queue, 1, &submit_info, VK_NULL_HANDLE);
+
+    m_errorMonitor->VerifyFound();
+    vkQueueWaitIdle(m_device->m_queue);
+    vkFreeMemory(m_device->handle(), mem, NULL);
+}
+
+TEST_F(VkLayerTest, InvalidCmdBufferBufferDestroyedWhileRecordingLazyInvalidation) {
+    TEST_DESCRIPTION(
+        "Record into a command buffer after destroying a buffer it uses, with command buffers invalidated lazily. Each command "
+        "is reported as it would be had the command buffer been invalidated when the buffer was destroyed.");
+    if (!ScopedLayerEnable::Supported()) {
+        printf("%s Layer enables cannot be set on this platform.\n", kSkipPrefix);
+        return;
+    }
+    ScopedLayerEnable lazy_invalidation("VALIDATION_CHECK_ENABLE_LAZY_COMMAND_BUFFER_INVALIDATION");
+    ASSERT_NO_FATAL_FAILURE(Init());
+
+    VkMemoryPropertyFlags reqs = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT;
+    VkBufferObj other_buffer;
+    other_buffer.init_as_dst(*m_device, 256, reqs);
+
+    VkBuffer buffer;
+    VkDeviceMemory mem;
+    if (!CreateBufferWithMemory(m_device, VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT, &buffer, &mem)) {
+        printf("%s Failed to create a buffer with host visible memory.\n", kSkipPrefix);
+        return;
+    }
+
+    m_commandBuffer->begin();
+    vkCmdFillBuffer(m_commandBuffer->handle(), buffer, 0, VK_WHOLE_SIZE, 0);
+    vkDestroyBuffer(m_device->device(), buffer, NULL);
+
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, " that is invalid because bound Buffer ");
+    vkCmdFillBuffer(m_commandBuffer->handle(), other_buffer.handle(), 0, VK_WHOLE_SIZE, 0);
+    m_errorMonitor->VerifyFound();
+
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, " that is invalid because bound Buffer ");
+    vkEndCommandBuffer(m_commandBuffer->handle());
+    m_errorMonitor->VerifyFound();
+
+    vkFreeMemory(m_device->handle(), mem, NULL);
+}
+
+TEST_F(VkLayerTest, InvalidSecondaryCmdBufferBufferDestroyedLazyInvalidation) {
+    TEST_DESCRIPTION(
+        "Execute a secondary command buffer that is invalid due to a buffer dependency being destroyed, with command buffers "
+        "invalidated lazily.");
+    if (!ScopedLayerEnable::Supported()) {
+        printf("%s Layer enables cannot be set on this platform.\n", kSkipPrefix);
+        return;
+    }
+    ScopedLayerEnable lazy_invalidation("VALIDATION_CHECK_ENABLE_LAZY_COMMAND_BUFFER_INVALIDATION");
+    ASSERT_NO_FATAL_FAILURE(Init());
+
+    VkBuffer buffer;
+    VkDeviceMemory mem;
+    if (!CreateBufferWithMemory(m_device, VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT, &buffer, &mem)) {
+        printf("%s Failed to create a buffer with host visible memory.\n", kSkipPrefix);
+        return;
+    }
+
+    VkCommandBufferObj secondary(m_device, m_commandPool, VK_COMMAND_BUFFER_LEVEL_SECONDARY);
+    secondary.begin();
+    vkCmdFillBuffer(secondary.handle(), buffer, 0, VK_WHOLE_SIZE, 0);
+    secondary.end();
+
+    // Nothing looks at the secondary between the destruction and vkCmdExecuteCommands, which must find the buffer itself
+    vkDestroyBuffer(m_device->device(), buffer, NULL);
+
+    m_commandBuffer->begin();
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, " that is invalid because bound Buffer ");
+    vkCmdExecuteCommands(m_commandBuffer->handle(), 1, &secondary.handle());
+    m_errorMonitor->VerifyFound();
+    m_commandBuffer->end();
+
+    vkFreeMemory(m_device->handle(), mem, NULL);
+}
+
+TEST_F(VkLayerTest, DeferredValidationReportsRecordingErrors) {
+    TEST_DESCRIPTION(
+        "Record an invalid command with deferred validation, and expect it to be reported once deferred work is waited for.");
+    if (!ScopedEnvironmentVariable::Supported()) {
+        printf("%s Deferred validation cannot be requested on this platform.\n", kSkipPrefix);
+        return;
+    }
+    ScopedEnvironmentVariable deferred_validation("VK_LAYER_DEFERRED_VALIDATION_THREADS", "2");
+    ASSERT_NO_FATAL_FAILURE(Init());
+
+    VkMemoryPropertyFlags reqs = 0;
+    VkBufferObj buffer;
+    buffer.init_as_src(*m_device, 256, reqs);
+
+    // The fill is passed down the chain, and validated on a worker afterwards
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, "VUID-vkCmdFillBuffer-dstBuffer-00029");
+    m_commandBuffer->begin();
+    vkCmdFillBuffer(m_commandBuffer->handle(), buffer.handle(), 0, VK_WHOLE_SIZE, 0);
+    m_commandBuffer->end();
+    vkDeviceWaitIdle(m_device->device());
+    m_errorMonitor->VerifyFound();
+}
+
+TEST_F(VkLayerTest, DeferredValidationOrdersDestroyAfterRecording) {
+    TEST_DESCRIPTION(
+        "Destroy a buffer used by a command buffer being recorded with deferred validation. The destruction must see the deferred "
+        "recording of the command that used the buffer, so ending the command buffer reports it as invalid.");
+    if (!ScopedEnvironmentVariable::Supported()) {
+        printf("%s Deferred validation cannot be requested on this platform.\n", kSkipPrefix);
+        return;
+    }
+    ScopedEnvironmentVariable deferred_validation("VK_LAYER_DEFERRED_VALIDATION_THREADS", "2");
+    ASSERT_NO_FATAL_FAILURE(Init());
+
+    VkBuffer buffer;
+    VkDeviceMemory mem;
+    if (!CreateBufferWithMemory(m_device, VK_BUFFER_USAGE_TRANSFER_DST_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT, &buffer, &mem)) {
+        printf("%s Failed to create a buffer with host visible memory.\n", kSkipPrefix);
+        return;
+    }
+
+    m_commandBuffer->begin();
+    vkCmdFillBuffer(m_commandBuffer->handle(), buffer, 0, VK_WHOLE_SIZE, 0);
+    vkDestroyBuffer(m_device->device(), buffer, NULL);
+
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, " that is invalid because bound Buffer ");
+    vkEndCommandBuffer(m_commandBuffer->handle());
+    vkDeviceWaitIdle(m_device->device());
+    m_errorMonitor->VerifyFound();
+
+    vkFreeMemory(m_device->handle(), mem, NULL);
+}
+
 TEST_F(VkLayerTest, InvalidCmdBufferBufferViewDestroyed) {
     TEST_DESCRIPTION("Delete bufferView bound to cmd buffer, then attempt to submit cmd buffer.");
 
@@ -11089,6 +11403,36 @@ TEST_F(VkLayerTest, InvalidCmdBufferPipelineDestroyed) {
     m_errorMonitor->VerifyFound();
 }
 
+TEST_F(VkLayerTest, InvalidCmdBufferPipelineDestroyedLazyInvalidation) {
+    TEST_DESCRIPTION(
+        "Attempt to submit a command buffer that is invalid due to a pipeline dependency being destroyed, with command buffers "
+        "invalidated lazily.");
+    if (!ScopedLayerEnable::Supported()) {
+        printf("%s Layer enables cannot be set on this platform.\n", kSkipPrefix);
+        return;
+    }
+    ScopedLayerEnable lazy_invalidation("VALIDATION_CHECK_ENABLE_LAZY_COMMAND_BUFFER_INVALIDATION");
+    ASSERT_NO_FATAL_FAILURE(Init());
+    ASSERT_NO_FATAL_FAILURE(InitRenderTarget());
+
+    {
+        CreatePipelineHelper helper(*this);
+        helper.InitInfo();
+        helper.InitState();
+        helper.CreateGraphicsPipeline();
+
+        m_commandBuffer->begin();
+        vkCmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, helper.pipeline_);
+        m_commandBuffer->end();
+
+        // pipeline will be destroyed when helper goes out of scope
+    }
+
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, " that is invalid because bound Pipeline ");
+    m_commandBuffer->QueueCommandBuffer(false);
+    m_errorMonitor->VerifyFound();
+}
+
 TEST_F(VkPositiveLayerTest, DestroyPipelineRenderPass) {
     TEST_DESCRIPTION("Draw using a pipeline whose create renderPass has been destroyed.");
     m_errorMonitor->ExpectSuccess();
@@ -11321,6 +11665,112 @@ TEST_F(VkLayerTest, InvalidCmdBufferDescriptorSetBufferDestroyed) {
     vkDestroyDescriptorPool(m_device->device(), ds_pool, NULL);
 }
 
+TEST_F(VkLayerTest, InvalidCmdBufferDescriptorSetBufferDestroyedLazyInvalidation) {
+    TEST_DESCRIPTION(
+        "Attempt to submit command buffers that are invalid due to a bound descriptor set's buffer being destroyed and to the set "
+        "being updated, with command buffers invalidated lazily.");
+    if (!ScopedLayerEnable::Supported()) {
+        printf("%s Layer enables cannot be set on this platform.\n", kSkipPrefix);
+        return;
+    }
+    ScopedLayerEnable lazy_invalidation("VALIDATION_CHECK_ENABLE_LAZY_COMMAND_BUFFER_INVALIDATION");
+    ASSERT_NO_FATAL_FAILURE(Init(nullptr, nullptr, VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT));
+    ASSERT_NO_FATAL_FAILURE(InitViewport());
+    ASSERT_NO_FATAL_FAILURE(InitRenderTarget());
+
+    OneOffDescriptorSet ds(m_device, {
+                                         {0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_ALL, nullptr},
+                                     });
+    const VkPipelineLayoutObj pipeline_layout(m_device, {&ds.layout_});
+
+    VkBuffer buffer;
+    VkDeviceMemory mem;
+    if (!CreateBufferWithMemory(m_device, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT, 0, &buffer, &mem)) {
+        printf("%s Failed to create a buffer with memory.\n", kSkipPrefix);
+        return;
+    }
+
+    VkBufferObj other_buffer;
+    other_buffer.init(*m_device, VkBufferObj::create_info(256, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT));
+
+    VkDescriptorBufferInfo buffInfo = {};
+    buffInfo.buffer = buffer;
+    buffInfo.offset = 0;
+    buffInfo.range = VK_WHOLE_SIZE;
+
+    VkWriteDescriptorSet descriptor_write = {};
+    descriptor_write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    descriptor_write.dstSet = ds.set_;
+    descriptor_write.dstBinding = 0;
+    descriptor_write.descriptorCount = 1;
+    descriptor_write.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+    descriptor_write.pBufferInfo = &buffInfo;
+
+    vkUpdateDescriptorSets(m_device->device(), 1, &descriptor_write, 0, NULL);
+
+    char const *fsSource =
+        "#version 450\n"
+        "\n"
+        "layout(location=0) out vec4 x;\n"
+        "layout(set=0) layout(binding=0) uniform foo { int x; int y; } bar;\n"
+        "void main(){\n"
+        "   x = vec4(bar.y);\n"
+        "}\n";
+    VkShaderObj vs(m_device, bindStateVertShaderText, VK_SHADER_STAGE_VERTEX_BIT, this);
+    VkShaderObj fs(m_device, fsSource, VK_SHADER_STAGE_FRAGMENT_BIT, this);
+    VkPipelineObj pipe(m_device);
+    pipe.AddShader(&vs);
+    pipe.AddShader(&fs);
+    pipe.AddDefaultColorAttachment();
+    pipe.CreateVKPipeline(pipeline_layout.handle(), renderPass());
+
+    auto record = [&]() {
+        m_commandBuffer->begin();
+        m_commandBuffer->BeginRenderPass(m_renderPassBeginInfo);
+        vkCmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.handle());
+        vkCmdBindDescriptorSets(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline_layout.handle(), 0, 1,
+                                &ds.set_, 0, NULL);
+        vkCmdSetViewport(m_commandBuffer->handle(), 0, 1, &m_viewports[0]);
+        vkCmdSetScissor(m_commandBuffer->handle(), 0, 1, &m_scissors[0]);
+        m_commandBuffer->Draw(1, 0, 0, 0);
+        m_commandBuffer->EndRenderPass();
+        m_commandBuffer->end();
+    };
+
+    VkSubmitInfo submit_info = {};
+    submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submit_info.commandBufferCount = 1;
+    submit_info.pCommandBuffers = &m_commandBuffer->handle();
+
+    // The destroyed buffer is found through the descriptor set when the command buffer is submitted
+    record();
+    vkDestroyBuffer(m_device->device(), buffer, NULL);
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, " that is invalid because bound Buffer ");
+    vkQueueSubmit(m_device->m_queue, 1, &submit_info, VK_NULL_HANDLE);
+    m_errorMonitor->VerifyFound();
+
+    // Updating the set after recording is found the same way
+    buffInfo.buffer = other_buffer.handle();
+    vkUpdateDescriptorSets(m_device->device(), 1, &descriptor_write, 0, NULL);
+    record();
+    vkUpdateDescriptorSets(m_device->device(), 1, &descriptor_write, 0, NULL);
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, " that is invalid because bound DescriptorSet ");
+    vkQueueSubmit(m_device->m_queue, 1, &submit_info, VK_NULL_HANDLE);
+    m_errorMonitor->VerifyFound();
+
+    // Each update is reported, as it is with eager invalidation
+    record();
+    vkUpdateDescriptorSets(m_device->device(), 1, &descriptor_write, 0, NULL);
+    vkUpdateDescriptorSets(m_device->device(), 1, &descriptor_write, 0, NULL);
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, " that is invalid because bound DescriptorSet ");
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, " that is invalid because bound DescriptorSet ");
+    vkQueueSubmit(m_device->m_queue, 1, &submit_info, VK_NULL_HANDLE);
+    m_errorMonitor->VerifyFound();
+
+    vkQueueWaitIdle(m_device->m_queue);
+    vkFreeMemory(m_device->device(), mem, NULL);
+}
+
 TEST_F(VkLayerTest, InvalidCmdBufferDescriptorSetImageSamplerDestroyed) {
     TEST_DESCRIPTION(
         "Attempt to draw with a command buffer that is invalid due to a bound descriptor sets with a combined image sampler having "
@@ -30680,6 +31130,104 @@ TEST_F(VkLayerTest, CreateDescriptorUpdateTemplate) {
     do_test("VUID-VkDescriptorUpdateTemplateCreateInfo-templateType-00353");
 }
 
+// This is a positive test. No failures are expected.
+TEST_F(VkPositiveLayerTest, UpdateDescriptorSetWithTemplateMixedTypes) {
+    TEST_DESCRIPTION("Update a descriptor set with a template whose entries hold image, buffer, and texel buffer descriptors.");
+
+    ASSERT_NO_FATAL_FAILURE(InitFramework(myDbgFunc, m_errorMonitor));
+    if (DeviceExtensionSupported(gpu(), nullptr, VK_KHR_DESCRIPTOR_UPDATE_TEMPLATE_EXTENSION_NAME)) {
+        m_device_extension_names.push_back(VK_KHR_DESCRIPTOR_UPDATE_TEMPLATE_EXTENSION_NAME);
+    } else {
+        printf("%s Descriptor Update Template Extension not supported, skipped.\n", kSkipPrefix);
+        return;
+    }
+    ASSERT_NO_FATAL_FAILURE(InitState());
+
+    auto vkCreateDescriptorUpdateTemplateKHR =
+        (PFN_vkCreateDescriptorUpdateTemplateKHR)vkGetDeviceProcAddr(m_device->device(), "vkCreateDescriptorUpdateTemplateKHR");
+    auto vkDestroyDescriptorUpdateTemplateKHR =
+        (PFN_vkDestroyDescriptorUpdateTemplateKHR)vkGetDeviceProcAddr(m_device->device(), "vkDestroyDescriptorUpdateTemplateKHR");
+    auto vkUpdateDescriptorSetWithTemplateKHR =
+        (PFN_vkUpdateDescriptorSetWithTemplateKHR)vkGetDeviceProcAddr(m_device->device(), "vkUpdateDescriptorSetWithTemplateKHR");
+    ASSERT_NE(vkCreateDescriptorUpdateTemplateKHR, nullptr);
+    ASSERT_NE(vkDestroyDescriptorUpdateTemplateKHR, nullptr);
+    ASSERT_NE(vkUpdateDescriptorSetWithTemplateKHR, nullptr);
+
+    OneOffDescriptorSet ds(m_device, {
+                                         {0, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 2, VK_SHADER_STAGE_ALL, nullptr},
+                                         {1, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_ALL, nullptr},
+                                         {2, VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER, 1, VK_SHADER_STAGE_ALL, nullptr},
+                                     });
+
+    VkImageObj image(m_device);
+    image.Init(32, 32, 1, VK_FORMAT_B8G8R8A8_UNORM, VK_IMAGE_USAGE_SAMPLED_BIT, VK_IMAGE_TILING_OPTIMAL, 0);
+    ASSERT_TRUE(image.initialized());
+    VkImageView image_view = image.targetView(VK_FORMAT_B8G8R8A8_UNORM);
+
+    VkSamplerCreateInfo sampler_ci = SafeSaneSamplerCreateInfo();
+    VkSampler sampler;
+    VkResult err = vkCreateSampler(m_device->device(), &sampler_ci, NULL, &sampler);
+    ASSERT_VK_SUCCESS(err);
+
+    VkBufferObj uniform_buffer;
+    uniform_buffer.init(*m_device, VkBufferObj::create_info(256, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT));
+    VkBufferObj texel_buffer;
+    texel_buffer.init(*m_device, VkBufferObj::create_info(256, VK_BUFFER_USAGE_UNIFORM_TEXEL_BUFFER_BIT));
+
+    VkBufferViewCreateInfo bvci = {};
+    bvci.sType = VK_STRUCTURE_TYPE_BUFFER_VIEW_CREATE_INFO;
+    bvci.buffer = texel_buffer.handle();
+    bvci.format = VK_FORMAT_R32_SFLOAT;
+    bvci.range = VK_WHOLE_SIZE;
+    VkBufferView buffer_view;
+    err = vkCreateBufferView(m_device->device(), &bvci, NULL, &buffer_view);
+    ASSERT_VK_SUCCESS(err);
+
+    // Descriptors of each type at unaligned offsets, with plain data in between
+    struct MixedTemplateData {
+        VkDescriptorImageInfo image_infos[2];
+        uint8_t padding[3];
+        VkDescriptorBufferInfo buffer_info;
+        uint32_t other_padding;
+        VkBufferView texel_buffer_view;
+    };
+    MixedTemplateData update_template_data = {};
+    for (auto &image_info : update_template_data.image_infos) {
+        image_info.sampler = sampler;
+        image_info.imageView = image_view;
+        image_info.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+    }
+    update_template_data.buffer_info = {uniform_buffer.handle(), 0, VK_WHOLE_SIZE};
+    update_template_data.texel_buffer_view = buffer_view;
+
+    const VkDescriptorUpdateTemplateEntry update_template_entries[] = {
+        {0, 0, 2, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, offsetof(MixedTemplateData, image_infos),
+         sizeof(VkDescriptorImageInfo)},
+        {1, 0, 1, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, offsetof(MixedTemplateData, buffer_info), sizeof(MixedTemplateData)},
+        {2, 0, 1, VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER, offsetof(MixedTemplateData, texel_buffer_view),
+         sizeof(MixedTemplateData)},
+    };
+
+    auto update_template_ci = lvl_init_struct<VkDescriptorUpdateTemplateCreateInfoKHR>();
+    update_template_ci.descriptorUpdateEntryCount = 3;
+    update_template_ci.pDescriptorUpdateEntries = update_template_entries;
+    update_template_ci.templateType = VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET;
+    update_template_ci.descriptorSetLayout = ds.layout_.handle();
+
+    m_errorMonitor->ExpectSuccess();
+    VkDescriptorUpdateTemplate update_template = VK_NULL_HANDLE;
+    err = vkCreateDescriptorUpdateTemplateKHR(m_device->device(), &update_template_ci, nullptr, &update_template);
+    ASSERT_VK_SUCCESS(err);
+    vkUpdateDescriptorSetWithTemplateKHR(m_device->device(), ds.set_, update_template, &update_template_data);
+    // A second update reuses the thread's unwrapping buffers
+    vkUpdateDescriptorSetWithTemplateKHR(m_device->device(), ds.set_, update_template, &update_template_data);
+    m_errorMonitor->VerifyNotFound();
+
+    vkDestroyDescriptorUpdateTemplateKHR(m_device->device(), update_template, nullptr);
+    vkDestroyBufferView(m_device->device(), buffer_view, NULL);
+    vkDestroySampler(m_device->device(), sampler, NULL);
+}
+
 // This is a positive test. No failures are expected.
 TEST_F(VkPositiveLayerTest, PushDescriptorNullDstSetTest) {
     TEST_DESCRIPTION("Use null dstSet in CmdPushDescriptorSetKHR");
@@ -10,3 +10,9 @@ set -e
 # catch the errors that they are supposed to by intentionally doing things
 # that are wrong
 ./vk_layer_validation_tests
+
+# vk_layer_replay_tests write API captures and replay them through the
+# validation objects, without a driver
+if [ -x ./vk_layer_replay_tests ]; then
+    ./vk_layer_replay_tests
+fi